@@ -0,0 +1,38 @@
+/**
+ * GasGuard - Adaptive Sampling-Rate Controller (implementation)
+ *
+ * Platform-free: no clock, no ADC, no Serial. The caller supplies
+ * time; profile side effects go through the registered hook.
+ */
+
+#include "adaptive_sampler.h"
+
+static bool escalated = false;
+static uint32_t lastNonNormalMs = 0;
+static AdaptiveProfileHook profileHook = 0;
+
+uint32_t adaptiveSamplerUpdate(RiskState risk, uint32_t nowMs) {
+  if (risk > RISK_NORMAL) {
+    lastNonNormalMs = nowMs;
+
+    if (!escalated) {
+      // Escalate immediately: resolution matters most right now
+      escalated = true;
+      if (profileHook) profileHook(ADAPTIVE_ACTIVE_ALPHA, true);
+    }
+  } else if (escalated && (nowMs - lastNonNormalMs) >= ADAPTIVE_HOLD_MS) {
+    // De-escalate only after a full quiet hold period
+    escalated = false;
+    if (profileHook) profileHook(ADAPTIVE_IDLE_ALPHA, false);
+  }
+
+  return escalated ? ADAPTIVE_ACTIVE_PERIOD_MS : ADAPTIVE_IDLE_PERIOD_MS;
+}
+
+void adaptiveSamplerOnProfileChange(AdaptiveProfileHook hook) {
+  profileHook = hook;
+}
+
+bool adaptiveSamplerEscalated() {
+  return escalated;
+}
@@ -0,0 +1,59 @@
+/**
+ * GasGuard - Adaptive Sampling-Rate Controller
+ *
+ * Closed-loop replacement for the hard-coded NUM_SAMPLES / SAMPLE_DELAY
+ * / delay(5000) cadence. While every channel sits in the NORMAL band
+ * the node samples slowly with heavy smoothing (battery-friendly); the
+ * moment any channel crosses LOW_ANOMALY it escalates to 10 Hz with a
+ * light filter weight so a developing leak is resolved at full rate.
+ *
+ * Hysteresis: escalation is immediate, de-escalation only after the
+ * risk has stayed NORMAL for ADAPTIVE_HOLD_MS — a reading bouncing on
+ * the LOW_ANOMALY edge cannot thrash the rate.
+ *
+ * Platform-free (see gasguard_core.h): time is passed in, and profile
+ * side effects (the ADC filter weight on-device) go through an
+ * injected hook instead of a direct adc_sampler call, so the exact
+ * controller runs in the host simulation harness (sim/).
+ */
+
+#ifndef GASGUARD_ADAPTIVE_SAMPLER_H
+#define GASGUARD_ADAPTIVE_SAMPLER_H
+
+#include <stdint.h>
+
+#include "risk_classifier.h"
+
+// Quiet profile: NORMAL band
+#define ADAPTIVE_IDLE_PERIOD_MS   5000           // matches the old loop() cadence
+#define ADAPTIVE_IDLE_ALPHA       (1.0f / 32.0f) // heavy smoothing
+
+// Escalated profile: any channel at LOW_ANOMALY or above
+#define ADAPTIVE_ACTIVE_PERIOD_MS 100            // 10 Hz
+#define ADAPTIVE_ACTIVE_ALPHA     (1.0f / 4.0f)  // fast tracking
+
+// De-escalation hold: risk must stay NORMAL this long before slowing
+#define ADAPTIVE_HOLD_MS          30000
+
+/**
+ * Feed the controller the risk state of the snapshot just taken and
+ * the current time. Returns the period (ms) the sampling task should
+ * wait before the next snapshot; fires the profile hook on changes.
+ */
+uint32_t adaptiveSamplerUpdate(RiskState risk, uint32_t nowMs);
+
+/**
+ * Called on every profile change with the new filter weight. The
+ * firmware registers adcSamplerSetFilterAlpha (plus a log line) here;
+ * the simulation registers its own filter bank.
+ */
+typedef void (*AdaptiveProfileHook)(float alpha, bool escalated);
+
+void adaptiveSamplerOnProfileChange(AdaptiveProfileHook hook);
+
+/**
+ * True while the escalated (10 Hz) profile is active.
+ */
+bool adaptiveSamplerEscalated();
+
+#endif // GASGUARD_ADAPTIVE_SAMPLER_H
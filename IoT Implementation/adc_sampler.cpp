@@ -0,0 +1,268 @@
+/**
+ * GasGuard - Non-blocking ADC Sampling Engine (implementation)
+ *
+ * Uses the ESP32 I2S peripheral in built-in ADC mode. The I2S DMA engine
+ * reads ADC1 continuously into DMA descriptors; a background FreeRTOS task
+ * drains the DMA buffers and demultiplexes samples into per-channel ring
+ * buffers. Each 16-bit DMA word carries the ADC1 channel number in bits
+ * 15:12 and the 12-bit conversion result in bits 11:0, so demuxing is a
+ * shift and a mask per sample.
+ */
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+#include <driver/adc.h>
+#include <soc/syscon_reg.h>
+
+#include "adc_sampler.h"
+#include "stream_filter.h"
+
+// V_REF / ADC_MAX mirror the constants in sensor_ppm_converter.cpp
+#define SAMPLER_V_REF    3.3
+#define SAMPLER_ADC_MAX  4095.0
+
+#define SAMPLER_I2S_PORT I2S_NUM_0
+
+// ============================================================================
+// CHANNEL STATE
+// ============================================================================
+
+struct AdcChannelState {
+  int pin;                                  // GPIO number
+  adc1_channel_t adcChannel;                // ADC1 channel for this pin
+  volatile uint16_t ring[ADC_SAMPLER_RING_SIZE];
+  volatile uint32_t writeIndex;             // monotonically increasing
+  StreamFilter filter;                      // EWMA + glitch rejection
+};
+
+static AdcChannelState channels[ADC_SAMPLER_MAX_CHANNELS];
+static size_t numChannels = 0;
+static TaskHandle_t drainTaskHandle = NULL;
+static bool samplerRunning = false;
+
+/**
+ * Map a GPIO pin to its ADC1 channel, or ADC1_CHANNEL_MAX if not on ADC1
+ */
+static adc1_channel_t pinToAdc1Channel(int pin) {
+  switch (pin) {
+    case 36: return ADC1_CHANNEL_0;
+    case 37: return ADC1_CHANNEL_1;
+    case 38: return ADC1_CHANNEL_2;
+    case 39: return ADC1_CHANNEL_3;
+    case 32: return ADC1_CHANNEL_4;
+    case 33: return ADC1_CHANNEL_5;
+    case 34: return ADC1_CHANNEL_6;
+    case 35: return ADC1_CHANNEL_7;
+    default: return ADC1_CHANNEL_MAX;
+  }
+}
+
+static AdcChannelState *findChannel(int pin) {
+  for (size_t i = 0; i < numChannels; i++) {
+    if (channels[i].pin == pin) return &channels[i];
+  }
+  return NULL;
+}
+
+static AdcChannelState *findChannelByAdc(int adcChannel) {
+  for (size_t i = 0; i < numChannels; i++) {
+    if (channels[i].adcChannel == adcChannel) return &channels[i];
+  }
+  return NULL;
+}
+
+// ============================================================================
+// DMA DRAIN TASK
+// ============================================================================
+
+/**
+ * Background task: blocks on i2s_read() (DMA-driven, no busy wait),
+ * demuxes each sample into its channel ring buffer.
+ */
+static void adcDrainTask(void *arg) {
+  static uint16_t dmaBuffer[ADC_SAMPLER_DMA_CHUNK];
+
+  while (samplerRunning) {
+    size_t bytesRead = 0;
+    esp_err_t err = i2s_read(SAMPLER_I2S_PORT, dmaBuffer, sizeof(dmaBuffer),
+                             &bytesRead, portMAX_DELAY);
+    if (err != ESP_OK || bytesRead == 0) {
+      continue;
+    }
+
+    size_t samplesRead = bytesRead / sizeof(uint16_t);
+    for (size_t i = 0; i < samplesRead; i++) {
+      uint16_t raw = dmaBuffer[i];
+      int adcChannel = (raw >> 12) & 0x0F;
+      uint16_t value = raw & 0x0FFF;
+
+      AdcChannelState *ch = findChannelByAdc(adcChannel);
+      if (ch != NULL) {
+        uint32_t idx = ch->writeIndex;
+        ch->ring[idx % ADC_SAMPLER_RING_SIZE] = value;
+        ch->writeIndex = idx + 1;   // publish after the store
+
+        // Streaming estimate: O(1) per sample, glitches rejected
+        ch->filter.update((float)value);
+      }
+    }
+  }
+
+  vTaskDelete(NULL);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+bool adcSamplerBegin(const int *pins, size_t numPins) {
+  if (samplerRunning || numPins == 0 || numPins > ADC_SAMPLER_MAX_CHANNELS) {
+    return false;
+  }
+
+  // Register channels and validate pins
+  numChannels = 0;
+  for (size_t i = 0; i < numPins; i++) {
+    adc1_channel_t adcChannel = pinToAdc1Channel(pins[i]);
+    if (adcChannel == ADC1_CHANNEL_MAX) {
+      Serial.printf("❌ ADC sampler: pin %d is not on ADC1\n", pins[i]);
+      return false;
+    }
+    channels[numChannels].pin = pins[i];
+    channels[numChannels].adcChannel = adcChannel;
+    channels[numChannels].writeIndex = 0;
+    channels[numChannels].filter.reset();
+    numChannels++;
+
+    // Full-range attenuation, matching analogSetAttenuation(ADC_11db)
+    adc1_config_channel_atten(adcChannel, ADC_ATTEN_DB_11);
+  }
+  adc1_config_width(ADC_WIDTH_BIT_12);
+
+  // I2S in built-in ADC mode: the DMA engine pulls conversions continuously
+  i2s_config_t i2sConfig = {};
+  i2sConfig.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN);
+  i2sConfig.sample_rate = ADC_SAMPLER_RATE_HZ;
+  i2sConfig.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  i2sConfig.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+  i2sConfig.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+  i2sConfig.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
+  i2sConfig.dma_buf_count = 4;
+  i2sConfig.dma_buf_len = ADC_SAMPLER_DMA_CHUNK;
+  i2sConfig.use_apll = false;
+
+  if (i2s_driver_install(SAMPLER_I2S_PORT, &i2sConfig, 0, NULL) != ESP_OK) {
+    Serial.println("❌ ADC sampler: i2s_driver_install failed");
+    return false;
+  }
+
+  // Attach ADC1 to I2S; the first channel seeds the mode, the SYSCON
+  // pattern table (programmed below) does the actual channel selection
+  i2s_set_adc_mode(ADC_UNIT_1, channels[0].adcChannel);
+  i2s_adc_enable(SAMPLER_I2S_PORT);
+
+  // Program the ADC1 scan pattern so DMA cycles through every registered
+  // channel: pattern entry = channel(4) | width(2) | attenuation(2)
+  uint32_t pattern = 0;
+  for (size_t i = 0; i < numChannels; i++) {
+    uint8_t entry = (channels[i].adcChannel << 4) | (3 << 2) | 3;
+    pattern |= ((uint32_t)entry) << (24 - i * 8);
+  }
+  WRITE_PERI_REG(SYSCON_SARADC_SAR1_PATT_TAB1_REG, pattern);
+  SET_PERI_REG_BITS(SYSCON_SARADC_CTRL_REG, SYSCON_SARADC_SAR1_PATT_LEN,
+                    numChannels - 1, SYSCON_SARADC_SAR1_PATT_LEN_S);
+
+  samplerRunning = true;
+  xTaskCreate(adcDrainTask, "adc_drain", 2048, NULL,
+              configMAX_PRIORITIES - 2, &drainTaskHandle);
+
+  Serial.printf("✅ ADC sampler: %u channels @ %d Hz (DMA)\n",
+                (unsigned)numChannels, ADC_SAMPLER_RATE_HZ);
+  return true;
+}
+
+void adcSamplerEnd() {
+  if (!samplerRunning) return;
+
+  samplerRunning = false;
+  i2s_adc_disable(SAMPLER_I2S_PORT);
+  i2s_driver_uninstall(SAMPLER_I2S_PORT);
+  drainTaskHandle = NULL;
+  numChannels = 0;
+}
+
+float adcSamplerWindowAvg(int pin, size_t window) {
+  AdcChannelState *ch = findChannel(pin);
+  if (ch == NULL) return -1.0;
+
+  uint32_t head = ch->writeIndex;
+  if (head == 0) return -1.0;  // No samples yet
+
+  if (window == 0) window = 1;
+  if (window > ADC_SAMPLER_RING_SIZE) window = ADC_SAMPLER_RING_SIZE;
+  if (window > head) window = head;
+
+  uint32_t sum = 0;
+  for (size_t i = 0; i < window; i++) {
+    sum += ch->ring[(head - 1 - i) % ADC_SAMPLER_RING_SIZE];
+  }
+
+  return sum / (float)window;
+}
+
+float adcSamplerReadVoltage(int pin, size_t window) {
+  float avg = adcSamplerWindowAvg(pin, window);
+  if (avg < 0) return -1.0;
+
+  return avg * (SAMPLER_V_REF / SAMPLER_ADC_MAX);
+}
+
+float adcSamplerFilteredCounts(int pin) {
+  AdcChannelState *ch = findChannel(pin);
+  if (ch == NULL || !ch->filter.primed) return -1.0;
+
+  return ch->filter.value();
+}
+
+float adcSamplerFilteredVoltage(int pin) {
+  float counts = adcSamplerFilteredCounts(pin);
+  if (counts < 0) return -1.0;
+
+  return counts * (SAMPLER_V_REF / SAMPLER_ADC_MAX);
+}
+
+uint32_t adcSamplerRejectedCount(int pin) {
+  AdcChannelState *ch = findChannel(pin);
+  return (ch != NULL) ? ch->filter.rejected : 0;
+}
+
+void adcSamplerSetFilterAlpha(float alpha) {
+  for (size_t i = 0; i < numChannels; i++) {
+    channels[i].filter.alpha = alpha;
+  }
+}
+
+uint32_t adcSamplerSampleCount(int pin) {
+  AdcChannelState *ch = findChannel(pin);
+  return (ch != NULL) ? ch->writeIndex : 0;
+}
+
+bool adcSamplerExportFilter(int pin, float *mean, float *variance) {
+  AdcChannelState *ch = findChannel(pin);
+  if (ch == NULL || !ch->filter.primed) return false;
+
+  *mean = ch->filter.mean;
+  *variance = ch->filter.variance;
+  return true;
+}
+
+bool adcSamplerSeedFilter(int pin, float mean, float variance) {
+  AdcChannelState *ch = findChannel(pin);
+  if (ch == NULL) return false;
+
+  ch->filter.mean = mean;
+  ch->filter.variance =
+      variance > STREAM_FILTER_VAR_FLOOR ? variance : STREAM_FILTER_VAR_FLOOR;
+  ch->filter.primed = true;
+  return true;
+}
@@ -0,0 +1,116 @@
+/**
+ * GasGuard - Non-blocking ADC Sampling Engine
+ *
+ * Continuous ADC sampling via the ESP32 I2S/ADC-DMA path. The DMA engine
+ * fills per-channel ring buffers in the background so a "read" is just a
+ * lookup of the latest averaged window — microseconds instead of the
+ * 500 ms blocking loop in the old readVoltage().
+ *
+ * All four MQ sensor pins (34, 35, 32, 33) are on ADC1, which is the only
+ * ADC unit the I2S DMA path can drive, so no wiring changes are needed.
+ */
+
+#ifndef GASGUARD_ADC_SAMPLER_H
+#define GASGUARD_ADC_SAMPLER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// SAMPLER CONFIGURATION
+// ============================================================================
+
+// Total DMA sample rate, shared across all active channels
+#define ADC_SAMPLER_RATE_HZ     4000
+
+// Per-channel ring buffer depth (power of two, see adcSamplerWindowAvg)
+#define ADC_SAMPLER_RING_SIZE   256
+
+// DMA read buffer size in samples (one i2s_read chunk)
+#define ADC_SAMPLER_DMA_CHUNK   512
+
+// Maximum number of ADC channels the sampler can service
+#define ADC_SAMPLER_MAX_CHANNELS 4
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * Start the DMA sampling engine on the given GPIO pins.
+ * Pins must all map to ADC1 channels (GPIO 32-39 on ESP32).
+ *
+ * Returns true on success. After this call the per-channel ring buffers
+ * fill continuously in the background; no further polling is required.
+ */
+bool adcSamplerBegin(const int *pins, size_t numPins);
+
+/**
+ * Stop the DMA engine and release the I2S driver.
+ */
+void adcSamplerEnd();
+
+/**
+ * Latest averaged raw ADC value (0-4095) for the channel attached to `pin`.
+ *
+ * Averages the most recent `window` samples from the ring buffer.
+ * O(window) with no blocking — typically a few microseconds.
+ * Returns -1.0 if the pin is not a registered channel or no samples
+ * have arrived yet.
+ */
+float adcSamplerWindowAvg(int pin, size_t window);
+
+/**
+ * Latest averaged voltage (0 - V_REF) for the channel attached to `pin`.
+ * Same semantics as adcSamplerWindowAvg() but scaled to volts.
+ */
+float adcSamplerReadVoltage(int pin, size_t window);
+
+/**
+ * Current filtered raw value (counts) for the channel attached to `pin`.
+ *
+ * O(1): returns the streaming EWMA estimate maintained per-sample by
+ * the DMA drain task (see stream_filter.h), with ADC glitches already
+ * rejected. Preferred over adcSamplerWindowAvg() on the hot path.
+ * Returns -1.0 if the pin is unknown or no samples have arrived.
+ */
+float adcSamplerFilteredCounts(int pin);
+
+/**
+ * Same as adcSamplerFilteredCounts() but scaled to volts (0 - V_REF).
+ */
+float adcSamplerFilteredVoltage(int pin);
+
+/**
+ * Samples rejected as glitches by the channel's streaming filter.
+ */
+uint32_t adcSamplerRejectedCount(int pin);
+
+/**
+ * Set the streaming-filter mean weight on ALL channels. Used by the
+ * adaptive sampling controller to trade smoothing for responsiveness.
+ */
+void adcSamplerSetFilterAlpha(float alpha);
+
+/**
+ * Total samples captured on a channel since adcSamplerBegin().
+ * Useful for confirming the DMA stream is alive.
+ */
+uint32_t adcSamplerSampleCount(int pin);
+
+/**
+ * Read out a channel's streaming-filter state (mean/variance in
+ * counts). Returns false if the pin is unknown or the filter has not
+ * primed yet. Used by the deep-sleep duty cycler to carry warm filter
+ * state across sleep.
+ */
+bool adcSamplerExportFilter(int pin, float *mean, float *variance);
+
+/**
+ * Pre-prime a channel's streaming filter with saved state, so the
+ * first sample after (re)start updates a warm filter instead of
+ * starting the warm-up from scratch.
+ */
+bool adcSamplerSeedFilter(int pin, float mean, float variance);
+
+#endif // GASGUARD_ADC_SAMPLER_H
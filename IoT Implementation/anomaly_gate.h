@@ -0,0 +1,151 @@
+/**
+ * GasGuard - Sliding-Window Anomaly Uplink Gate
+ *
+ * Firmware mirror of the backend LSTM's 10-timestep window, using a
+ * cheap stand-in for the network: linear extrapolation from the two
+ * most recent snapshots, with the prediction residual normalized per
+ * channel by its NORMAL band width (same spirit as the ml-service
+ * scaler). >99% of traffic is flat NORMAL data; this gate keeps it off
+ * the wire.
+ *
+ * Transmission policy:
+ *   - residual above threshold OR any channel outside NORMAL
+ *     -> transmit at full rate (the interesting data)
+ *   - otherwise -> one heartbeat summary per minute so the backend
+ *     still sees the node alive and the trend charts stay anchored
+ *
+ * Pure C++, no Arduino dependencies; the caller supplies timestamps.
+ */
+
+#ifndef GASGUARD_ANOMALY_GATE_H
+#define GASGUARD_ANOMALY_GATE_H
+
+#include <stdint.h>
+
+#include "gas_readings.h"
+#include "risk_classifier.h"
+
+// Window length — matches the backend LSTM input sequence
+#define ANOMALY_WINDOW_SIZE     10
+
+// Residual threshold on the normalized scale. The backend maps
+// error <= 0.15 to NORMAL (ARCHITECTURE.md); above that the data is
+// interesting enough to ship at full rate.
+#define ANOMALY_RESIDUAL_NORMAL 0.15f
+
+// Quiet-period heartbeat interval
+#define ANOMALY_HEARTBEAT_MS    60000
+
+/**
+ * Flat image of a gate's window, small enough for RTC slow memory —
+ * the deep-sleep duty cycler carries it across sleeps so trend gating
+ * resumes mid-trend on wake.
+ */
+struct AnomalyGateState {
+  GasReadings window[ANOMALY_WINDOW_SIZE];
+  int32_t head;
+  int32_t count;
+};
+
+enum AnomalyGateDecision {
+  GATE_SUPPRESS  = 0,  // flat NORMAL data, keep off the wire
+  GATE_TRANSMIT  = 1,  // anomalous or out-of-band: full rate
+  GATE_HEARTBEAT = 2,  // quiet, but the periodic summary is due
+};
+
+class AnomalyGate {
+ public:
+  /**
+   * Fold in the newest snapshot and decide whether it goes on the
+   * wire. `risk` is the local classifier's verdict for this snapshot.
+   */
+  AnomalyGateDecision update(const GasReadings &r, RiskState risk,
+                             uint32_t nowMs) {
+    float res = residual(r);
+    push(r);
+
+    if (risk > RISK_NORMAL || res > ANOMALY_RESIDUAL_NORMAL) {
+      lastTransmitMs = nowMs;
+      return GATE_TRANSMIT;
+    }
+
+    if ((nowMs - lastTransmitMs) >= ANOMALY_HEARTBEAT_MS) {
+      lastTransmitMs = nowMs;
+      return GATE_HEARTBEAT;
+    }
+
+    suppressedCount++;
+    return GATE_SUPPRESS;
+  }
+
+  /**
+   * Normalized prediction error of the newest snapshot against a
+   * linear extrapolation of the previous two. 0 until the window has
+   * at least two entries.
+   */
+  float residual(const GasReadings &actual) const {
+    if (count < 2) return 0.0f;
+
+    const GasReadings &p1 = window[(head + ANOMALY_WINDOW_SIZE - 1) % ANOMALY_WINDOW_SIZE];
+    const GasReadings &p2 = window[(head + ANOMALY_WINDOW_SIZE - 2) % ANOMALY_WINDOW_SIZE];
+
+    // predicted = p1 + (p1 - p2), error normalized by NORMAL band top
+    float err = 0.0f;
+    err += channelError(actual.methane, p1.methane, p2.methane,
+                        METHANE_THRESHOLDS.lowAnomaly);
+    err += channelError(actual.lpg, p1.lpg, p2.lpg,
+                        LPG_THRESHOLDS.lowAnomaly);
+    err += channelError(actual.carbonMonoxide, p1.carbonMonoxide,
+                        p2.carbonMonoxide, CO_THRESHOLDS.lowAnomaly);
+    err += channelError(actual.hydrogenSulfide, p1.hydrogenSulfide,
+                        p2.hydrogenSulfide, H2S_THRESHOLDS.lowAnomaly);
+
+    return err / 4.0f;
+  }
+
+  /**
+   * Snapshots kept off the wire since boot
+   */
+  uint32_t suppressed() const { return suppressedCount; }
+
+  /**
+   * Copy the window out / back in (deep-sleep state carry; timestamps
+   * and counters deliberately excluded — millis() restarts on wake)
+   */
+  void exportState(AnomalyGateState &s) const {
+    for (int i = 0; i < ANOMALY_WINDOW_SIZE; i++) s.window[i] = window[i];
+    s.head = head;
+    s.count = count;
+  }
+
+  void importState(const AnomalyGateState &s) {
+    if (s.count < 0 || s.count > ANOMALY_WINDOW_SIZE ||
+        s.head < 0 || s.head >= ANOMALY_WINDOW_SIZE) {
+      return;  // Corrupt image: keep the empty window
+    }
+    for (int i = 0; i < ANOMALY_WINDOW_SIZE; i++) window[i] = s.window[i];
+    head = s.head;
+    count = s.count;
+  }
+
+ private:
+  static float channelError(float actual, float p1, float p2, float scale) {
+    float predicted = p1 + (p1 - p2);
+    float err = (actual - predicted) / scale;
+    return err < 0 ? -err : err;
+  }
+
+  void push(const GasReadings &r) {
+    window[head] = r;
+    head = (head + 1) % ANOMALY_WINDOW_SIZE;
+    if (count < ANOMALY_WINDOW_SIZE) count++;
+  }
+
+  GasReadings window[ANOMALY_WINDOW_SIZE] = {};
+  int head = 0;
+  int count = 0;
+  uint32_t lastTransmitMs = 0;
+  uint32_t suppressedCount = 0;
+};
+
+#endif // GASGUARD_ANOMALY_GATE_H
@@ -0,0 +1,84 @@
+/**
+ * GasGuard - SoA Batch Conversion Kernel
+ *
+ * Gateways run the counts->Rs->PPM pipeline for dozens of leaves x 4
+ * channels per tick; calling the scalar per-value path in a loop keeps
+ * the compiler from doing anything clever with it. This kernel takes a
+ * structure-of-arrays frame of raw ADC counts and converts a whole
+ * channel per call: contiguous input, contiguous output, no branches
+ * in the loop body (invalid counts are clamped into range and masked
+ * to 0 PPM by a multiply), so the arithmetic auto-vectorizes on
+ * host-class gateways — the LUT gather at the end is the remaining
+ * scalar step. On the ESP32 the same shape wins too: no per-call
+ * overhead and the constants stay in registers across the batch.
+ *
+ * Pure C++ on top of ppm_lut.h — the same kernel backs the ESP-NOW
+ * gateway aggregation on-device and the host replay engine, so there
+ * is exactly one optimized conversion to maintain.
+ */
+
+#ifndef GASGUARD_BATCH_CONVERT_H
+#define GASGUARD_BATCH_CONVERT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "ppm_lut.h"
+
+// Hardware constants, mirroring sensor_ppm_converter.cpp
+#define BATCH_V_REF   3.3f
+#define BATCH_ADC_MAX 4095.0f
+#define BATCH_RL      10.0f
+
+#define BATCH_NUM_CHANNELS 4
+
+/**
+ * One SoA frame: counts[ch] points at n contiguous raw ADC samples
+ * for that channel.
+ */
+struct BatchCountsFrame {
+  const uint16_t *counts[BATCH_NUM_CHANNELS];
+  size_t n;
+};
+
+/**
+ * Convert n raw ADC counts of one channel to PPM. Out-of-range counts
+ * (0 or rail) produce 0 PPM, matching the scalar path's invalid
+ * handling, without a branch in the loop.
+ */
+inline void batchConvertChannel(const uint16_t *counts, size_t n,
+                                const PpmLut &lut, float r0,
+                                float *ppmOut) {
+  const float countsToVolts = BATCH_V_REF / BATCH_ADC_MAX;
+  const float invR0 = 1.0f / r0;
+
+  for (size_t i = 0; i < n; i++) {
+    uint16_t raw = counts[i];
+
+    // Clamp into the valid conversion domain; remember validity as a
+    // 0/1 factor instead of branching
+    float valid = (raw > 0 && raw < (uint16_t)BATCH_ADC_MAX) ? 1.0f : 0.0f;
+    float c = raw < 1 ? 1.0f : (raw > 4094 ? 4094.0f : (float)raw);
+
+    float voltage = c * countsToVolts;
+    float rs = (BATCH_V_REF * BATCH_RL) / voltage - BATCH_RL;
+
+    ppmOut[i] = ppmLutLookup(lut, rs * invR0) * valid;
+  }
+}
+
+/**
+ * Convert a whole four-channel frame: one kernel call per channel,
+ * per-channel LUT and R0.
+ */
+inline void batchConvertFrame(const BatchCountsFrame &frame,
+                              const PpmLut luts[BATCH_NUM_CHANNELS],
+                              const float r0[BATCH_NUM_CHANNELS],
+                              float *ppmOut[BATCH_NUM_CHANNELS]) {
+  for (int ch = 0; ch < BATCH_NUM_CHANNELS; ch++) {
+    batchConvertChannel(frame.counts[ch], frame.n, luts[ch], r0[ch],
+                        ppmOut[ch]);
+  }
+}
+
+#endif // GASGUARD_BATCH_CONVERT_H
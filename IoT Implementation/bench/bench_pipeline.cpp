@@ -0,0 +1,160 @@
+/**
+ * GasGuard - Conversion/Filter Pipeline Micro-Benchmark
+ *
+ * Drives every hot-path stage with a recorded ADC trace (trace_data.h,
+ * generated from Datasets/ by extract_trace.py) and reports per-stage
+ * cost, so performance changes land with before/after numbers instead
+ * of "it feels faster".
+ *
+ * Builds two ways:
+ *   Host:  make && ./bench_pipeline      — ns/op and ops/sec via
+ *          std::chrono (the headers under test are Arduino-free)
+ *   ESP32: #include this file from a scratch sketch and call
+ *          benchRunAll() from setup() — cycles/op via the Xtensa
+ *          cycle counter (CCOUNT)
+ *
+ * Stages measured, matching the per-reading firmware path:
+ *   counts->Rs (float)        mirror of calculateRs() in
+ *                             sensor_ppm_converter.cpp
+ *   counts->Rs (Q16.16)       q16RsFromCounts(), fixed_point.h
+ *   Rs->PPM (pow)             the convertToPPM() reference path
+ *   Rs->PPM (LUT)             ppmLutLookup(), ppm_lut.h
+ *   filter update             StreamFilter::update(), stream_filter.h
+ *   classification            classifyReadings(), risk_classifier.h
+ *
+ * Each stage runs the full trace BENCH_REPEATS times with results fed
+ * into a volatile sink so nothing is optimized away.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "../fixed_point.h"
+#include "../ppm_lut.h"
+#include "../stream_filter.h"
+#include "../gas_readings.h"
+#include "../risk_classifier.h"
+#include "trace_data.h"
+
+#define BENCH_REPEATS 200
+
+// Constants mirroring sensor_ppm_converter.cpp (the sketch itself is
+// not linkable outside the Arduino build)
+#define BENCH_V_REF   3.3f
+#define BENCH_ADC_MAX 4095.0f
+#define BENCH_RL      10.0f
+#define BENCH_R0      10.0f
+#define BENCH_MQ6_A   1009.0
+#define BENCH_MQ6_B   -2.35
+
+// Sink defeating dead-code elimination
+static volatile float sinkF = 0;
+static volatile int sinkI = 0;
+
+// ============================================================================
+// TIMING (cycle counter on ESP32, steady_clock on host)
+// ============================================================================
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+
+static inline uint32_t benchTicks() {
+  uint32_t ccount;
+  __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+  return ccount;
+}
+
+static void benchReport(const char *stage, uint32_t ticks, uint32_t ops) {
+  Serial.printf("%-24s %8.1f cycles/op\n", stage, (double)ticks / ops);
+}
+
+#else
+
+#include <chrono>
+
+static inline uint64_t benchTicks() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+static void benchReport(const char *stage, uint64_t ns, uint64_t ops) {
+  double nsPerOp = (double)ns / ops;
+  printf("%-24s %8.2f ns/op  %12.0f ops/sec\n", stage, nsPerOp,
+         1e9 / nsPerOp);
+}
+
+#endif // ARDUINO
+
+#define BENCH_STAGE(name, body)                                  \
+  do {                                                           \
+    auto t0 = benchTicks();                                      \
+    for (int rep = 0; rep < BENCH_REPEATS; rep++) {              \
+      for (int i = 0; i < TRACE_LENGTH; i++) {                   \
+        body                                                     \
+      }                                                          \
+    }                                                            \
+    benchReport(name, benchTicks() - t0,                         \
+                (uint32_t)BENCH_REPEATS * TRACE_LENGTH);         \
+  } while (0)
+
+// ============================================================================
+// STAGES
+// ============================================================================
+
+/**
+ * Mirror of calculateRs() (float path) taking raw counts
+ */
+static inline float benchRsFloat(uint16_t counts) {
+  float voltage = counts * (BENCH_V_REF / BENCH_ADC_MAX);
+  if (voltage <= 0.0f || voltage >= BENCH_V_REF) return -1.0f;
+  return ((BENCH_V_REF * BENCH_RL) / voltage) - BENCH_RL;
+}
+
+void benchRunAll() {
+  static constexpr PpmLut lut = ppmLutBuild(BENCH_MQ6_A, BENCH_MQ6_B);
+  StreamFilter filter;
+
+  BENCH_STAGE("counts->Rs (float)", {
+    sinkF = benchRsFloat(TRACE_COUNTS[i]);
+  });
+
+  BENCH_STAGE("counts->Rs (Q16.16)", {
+    sinkI = q16RsFromCounts(TRACE_COUNTS[i]);
+  });
+
+  BENCH_STAGE("Rs->PPM (pow)", {
+    float rs = benchRsFloat(TRACE_COUNTS[i]);
+    sinkF = (float)(BENCH_MQ6_A * pow(rs / BENCH_R0, BENCH_MQ6_B));
+  });
+
+  BENCH_STAGE("Rs->PPM (LUT)", {
+    float rs = benchRsFloat(TRACE_COUNTS[i]);
+    sinkF = ppmLutLookup(lut, rs / BENCH_R0);
+  });
+
+  BENCH_STAGE("filter update", {
+    filter.update((float)TRACE_COUNTS[i]);
+    sinkF = filter.value();
+  });
+
+  BENCH_STAGE("classification", {
+    GasReadings r;
+    float rs = benchRsFloat(TRACE_COUNTS[i]);
+    r.methane = r.lpg = r.carbonMonoxide = r.hydrogenSulfide =
+        ppmLutLookup(lut, rs / BENCH_R0);
+    r.valid = true;
+    sinkI = (int)classifyReadings(r);
+  });
+}
+
+#ifndef ARDUINO
+int main() {
+  printf("GasGuard pipeline benchmark — %d-sample trace x %d repeats\n\n",
+         TRACE_LENGTH, BENCH_REPEATS);
+  benchRunAll();
+  return 0;
+}
+#endif
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+GasGuard - benchmark trace extractor
+
+Converts a recorded sensor trace from Datasets/ (xlsx, reading value in
+column D) into the ADC-count trace header the benchmark harness compiles
+in (trace_data.h). The ESP32 build has no filesystem to load a CSV from,
+so the trace is baked in; the host build uses the same header so both
+targets measure identical input.
+
+The dataset column is a PPM reading, so it is inverted through the MQ-6
+curve (PPM = A * (Rs/R0)^B with the constants from
+sensor_ppm_converter.cpp) back to the 12-bit ADC counts a node would
+have measured — the benchmark then exercises the exact counts->Rs->PPM
+path the firmware runs.
+
+Usage:
+    python3 extract_trace.py ../../Datasets/dataset01/lpg_sensor.xlsx > trace_data.h
+
+Uses only the standard library (the xlsx is unzipped and the sheet XML
+parsed directly) so it runs anywhere the repo checks out.
+"""
+
+import re
+import sys
+import zipfile
+
+# MQ-6 constants from sensor_ppm_converter.cpp
+A = 1009.0
+B = -2.35
+R0 = 10.0      # kOhm
+RL = 10.0      # kOhm
+V_REF = 3.3
+ADC_MAX = 4095.0
+
+MAX_SAMPLES = 2048
+
+
+def read_column_d(path):
+    """Numeric values of column D on sheet1, in row order."""
+    with zipfile.ZipFile(path) as z:
+        xml = z.read("xl/worksheets/sheet1.xml").decode()
+
+    values = []
+    # Cells look like <c r="D2" s="1"><v>24.97287</v></c>; cells with
+    # t="s" are shared-string references (headers), skipped here.
+    for ref, attrs, val in re.findall(
+            r'<c r="D(\d+)"([^>]*)><v>([^<]+)</v></c>', xml):
+        if 't="s"' in attrs:
+            continue
+        values.append(float(val))
+    return values
+
+
+def ppm_to_counts(ppm):
+    """Invert PPM through the MQ-6 curve to 12-bit ADC counts."""
+    if ppm <= 0:
+        ppm = 0.01
+    ratio = (ppm / A) ** (1.0 / B)
+    rs = ratio * R0
+    voltage = (V_REF * RL) / (rs + RL)
+    counts = int(round(voltage * ADC_MAX / V_REF))
+    return max(1, min(4094, counts))
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    values = read_column_d(sys.argv[1])[:MAX_SAMPLES]
+    if not values:
+        sys.stderr.write("no numeric values found in column D\n")
+        return 1
+
+    counts = [ppm_to_counts(v) for v in values]
+
+    print("// Generated by extract_trace.py from %s — do not edit" %
+          sys.argv[1].split("/")[-1])
+    print("// %d samples, dataset PPM inverted to 12-bit ADC counts" %
+          len(counts))
+    print("#ifndef GASGUARD_TRACE_DATA_H")
+    print("#define GASGUARD_TRACE_DATA_H")
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("#define TRACE_LENGTH %d" % len(counts))
+    print()
+    print("static const uint16_t TRACE_COUNTS[TRACE_LENGTH] = {")
+    for i in range(0, len(counts), 12):
+        row = ", ".join("%4d" % c for c in counts[i:i + 12])
+        print("  %s," % row)
+    print("};")
+    print()
+    print("#endif // GASGUARD_TRACE_DATA_H")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
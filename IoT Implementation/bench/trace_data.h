@@ -0,0 +1,183 @@
+// Generated by extract_trace.py from lpg_sensor.xlsx — do not edit
+// 2035 samples, dataset PPM inverted to 12-bit ADC counts
+#ifndef GASGUARD_TRACE_DATA_H
+#define GASGUARD_TRACE_DATA_H
+
+#include <stdint.h>
+
+#define TRACE_LENGTH 2035
+
+static const uint16_t TRACE_COUNTS[TRACE_LENGTH] = {
+   703,  697,  692,  690,  704,  697,  699,  701,  696,  688,  700,  703,
+   704,  694,  695,  697,  706,  708,  700,  699,  697,  690,  711,  702,
+   689,  702,  705,  698,  702,  697,  701,  699,  709,  696,  697,  697,
+   704,  689,  683,  698,  681,  693,  705,  695,  695,  700,  698,  687,
+   702,  700,  705,  702,  697,  701,  700,  692,  700,  705,  700,  707,
+   702,  706,  698,  701,  709,  701,  695,  694,  695,  699,  699,  699,
+   704,  693,  680,  694,  688,  687,  707,  697,  700,  695,  695,  700,
+   696,  698,  702,  698,  693,  697,  697,  695,  687,  687,  695,  702,
+   694,  688,  693,  691,  694,  695,  686,  678,  694,  687,  695,  695,
+   684,  692,  694,  702,  693,  701,  682,  687,  692,  687,  694,  692,
+   674,  690,  686,  697,  690,  696,  696,  695,  691,  689,  682,  695,
+   692,  693,  688,  688,  699,  679,  682,  689,  692,  692,  699,  690,
+   691,  686,  685,  686,  688,  690,  682,  692,  690,  691,  683,  695,
+   694,  699,  692,  692,  686,  693,  689,  691,  689,  696,  699,  693,
+   689,  704,  694,  689,  698,  698,  692,  709,  688,  697,  688,  696,
+   692,  695,  688,  689,  708,  682,  694,  694,  691,  698,  683,  700,
+   685,  701,  689,  687,  682,  682,  695,  686,  694,  689,  694,  688,
+   680,  675,  694,  692,  692,  690,  694,  691,  694,  694,  689,  698,
+   687,  693,  691,  679,  693,  693,  699,  696,  689,  690,  690,  693,
+   690,  694,  701,  698,  700,  689,  695,  683,  698,  697,  699,  700,
+   700,  682,  699,  689,  696,  692,  685,  698,  691,  697,  698,  698,
+   690,  686,  705,  698,  695,  688,  688,  697,  690,  694,  682,  690,
+   702,  702,  696,  688,  697,  693,  693,  706,  692,  700,  699,  695,
+   693,  699,  701,  703,  693,  698,  697,  707,  705,  700,  699,  692,
+   706,  701,  694,  693,  699,  703,  694,  704,  692,  690,  692,  700,
+   699,  705,  683,  706,  702,  697,  688,  697,  696,  702,  695,  707,
+   692,  694,  695,  704,  699,  700,  704,  705,  707,  713,  700,  694,
+   695,  708,  694,  700,  705,  695,  691,  701,  704,  698,  698,  703,
+   698,  699,  705,  711,  695,  705,  701,  685,  700,  704,  699,  695,
+   704,  707,  695,  702,  708,  703,  695,  698,  700,  691,  700,  702,
+   700,  700,  701,  702,  699,  708,  702,  700,  710,  704,  710,  707,
+   698,  695,  703,  705,  697,  712,  707,  702,  699,  702,  700,  694,
+   696,  696,  695,  697,  702,  703,  690,  698,  697,  685,  685,  703,
+   697,  689,  689,  700,  703,  691,  697,  703,  698,  705,  691,  706,
+   696,  697,  706,  700,  693,  701,  707,  694,  695,  691,  694,  703,
+   692,  707,  706,  702,  697,  701,  699,  698,  701,  698,  694,  694,
+   704,  699,  693,  702,  697,  695,  706,  705,  702,  704,  699,  700,
+   701,  709,  697,  702,  698,  704,  698,  691,  698,  692,  695,  700,
+   699,  704,  698,  699,  698,  694,  691,  700,  694,  695,  703,  696,
+   697,  703,  694,  698,  699,  693,  699,  712,  701,  691,  706,  704,
+   707,  699,  703,  705,  698,  704,  693,  688,  707,  711,  695,  696,
+   696,  707,  706,  700,  695,  697,  708,  703,  697,  706,  696,  695,
+   697,  697,  691,  694,  690,  697,  695,  696,  696,  710,  705,  705,
+   711,  699,  700,  697,  703,  710,  696,  706,  709,  707,  709,  712,
+   697,  707,  701,  701,  702,  704,  705,  706,  698,  705,  710,  700,
+   699,  700,  692,  705,  697,  692,  700,  696,  700,  703,  701,  711,
+   706,  705,  703,  705,  696,  698,  702,  698,  711,  701,  696,  701,
+   702,  696,  705,  708,  709,  706,  719,  708,  702,  701,  706,  705,
+   702,  696,  705,  693,  707,  705,  695,  707,  699,  709,  707,  698,
+   702,  708,  694,  696,  709,  707,  702,  697,  700,  706,  700,  703,
+   696,  698,  703,  700,  703,  697,  704,  704,  693,  694,  693,  699,
+   694,  701,  709,  682,  704,  698,  698,  706,  710,  699,  697,  711,
+   702,  699,  694,  704,  698,  696,  700,  701,  696,  696,  699,  710,
+   708,  705,  703,  696,  704,  704,  701,  697,  699,  696,  694,  707,
+   695,  694,  698,  700,  709,  705,  698,  705,  699,  705,  701,  708,
+   697,  702,  705,  709,  706,  700,  718,  702,  702,  703,  700,  712,
+   703,  697,  698,  702,  707,  710,  704,  702,  704,  709,  698,  703,
+   714,  702,  697,  704,  700,  705,  707,  701,  710,  694,  700,  711,
+   694,  695,  699,  706,  702,  709,  697,  693,  695,  705,  707,  700,
+   699,  694,  707,  689,  700,  715,  713,  695,  705,  699,  696,  701,
+   703,  708,  713,  701,  701,  695,  705,  702,  709,  702,  705,  702,
+   694,  710,  701,  701,  698,  701,  707,  705,  699,  707,  698,  698,
+   709,  708,  700,  709,  698,  699,  703,  699,  698,  709,  705,  700,
+   705,  702,  697,  699,  702,  691,  709,  701,  709,  719,  705,  694,
+   702,  705,  702,  698,  701,  702,  714,  696,  707,  702,  708,  706,
+   699,  708,  704,  705,  698,  698,  696,  704,  704,  701,  703,  700,
+   698,  688,  700,  695,  712,  697,  693,  700,  695,  697,  702,  694,
+   699,  698,  709,  696,  704,  691,  688,  699,  694,  704,  693,  709,
+   699,  697,  699,  705,  699,  700,  701,  701,  709,  696,  704,  697,
+   694,  702,  689,  697,  700,  706,  699,  695,  694,  698,  696,  703,
+   698,  695,  703,  701,  702,  692,  699,  703,  695,  711,  688,  711,
+   697,  697,  705,  691,  704,  700,  694,  712,  697,  704,  709,  700,
+   704,  704,  700,  700,  694,  703,  698,  702,  704,  694,  691,  696,
+   701,  698,  696,  697,  699,  701,  703,  714,  703,  699,  701,  700,
+   696,  711,  698,  697,  697,  697,  696,  698,  701,  699,  704,  704,
+   694,  702,  680,  695,  697,  704,  713,  695,  693,  705,  706,  694,
+   688,  700,  697,  709,  698,  698,  691,  690,  686,  694,  703,  693,
+   695,  694,  704,  691,  709,  693,  698,  712,  696,  698,  697,  694,
+   708,  707,  691,  700,  696,  690,  707,  714,  701,  696,  707,  702,
+   700,  706,  692,  707,  709,  690,  708,  685,  678,  707,  705,  697,
+   689,  698,  702,  690,  707,  700,  702,  685,  706,  706,  694,  699,
+   699,  700,  710,  697,  702,  695,  690,  691,  692,  689,  704,  694,
+   701,  686,  685,  689,  690,  689,  684,  689,  700,  689,  691,  704,
+   688,  697,  703,  701,  689,  701,  695,  690,  702,  694,  687,  698,
+   699,  698,  684,  679,  700,  696,  683,  694,  692,  693,  706,  692,
+   683,  688,  699,  689,  702,  692,  698,  690,  697,  691,  684,  694,
+   694,  689,  687,  691,  679,  695,  709,  696,  685,  683,  685,  685,
+   688,  685,  691,  687,  698,  688,  689,  703,  694,  684,  692,  698,
+   685,  692,  685,  693,  689,  681,  689,  682,  683,  696,  686,  698,
+   691,  695,  689,  691,  689,  681,  692,  685,  684,  696,  691,  685,
+   684,  694,  681,  693,  687,  690,  687,  685,  695,  687,  689,  685,
+   689,  696,  688,  695,  692,  693,  698,  686,  693,  678,  695,  697,
+   697,  691,  695,  692,  692,  687,  696,  684,  698,  686,  690,  687,
+   689,  692,  687,  693,  682,  685,  684,  684,  681,  695,  688,  683,
+   687,  694,  685,  681,  683,  681,  688,  683,  680,  671,  678,  680,
+   683,  676,  678,  676,  695,  683,  673,  686,  681,  685,  692,  681,
+   678,  686,  675,  670,  684,  685,  683,  670,  681,  686,  678,  690,
+   685,  683,  689,  676,  683,  682,  685,  688,  681,  682,  684,  686,
+   681,  685,  686,  682,  688,  678,  683,  676,  685,  684,  680,  686,
+   684,  691,  686,  670,  682,  679,  691,  684,  695,  686,  687,  679,
+   682,  683,  678,  684,  691,  684,  693,  674,  691,  671,  690,  689,
+   688,  685,  684,  695,  692,  686,  680,  690,  683,  679,  684,  681,
+   691,  685,  691,  688,  663,  683,  695,  691,  688,  689,  684,  692,
+   676,  693,  691,  683,  683,  687,  694,  694,  690,  681,  694,  702,
+   694,  706,  686,  695,  683,  691,  671,  691,  691,  686,  694,  688,
+   687,  693,  693,  684,  691,  692,  677,  688,  666,  689,  686,  690,
+   679,  685,  680,  675,  683,  686,  682,  675,  682,  680,  693,  690,
+   676,  685,  692,  677,  683,  679,  695,  681,  683,  687,  690,  681,
+   683,  692,  688,  692,  671,  693,  688,  686,  680,  688,  688,  677,
+   688,  678,  679,  683,  696,  685,  681,  689,  681,  688,  689,  682,
+   683,  687,  686,  679,  683,  686,  696,  696,  687,  690,  681,  688,
+   689,  677,  685,  680,  683,  676,  684,  685,  694,  682,  696,  684,
+   693,  684,  692,  684,  687,  677,  685,  681,  685,  684,  681,  678,
+   688,  679,  685,  678,  697,  682,  683,  691,  686,  697,  680,  682,
+   683,  682,  689,  684,  695,  675,  690,  693,  690,  689,  695,  689,
+   685,  684,  678,  684,  687,  688,  697,  680,  684,  685,  696,  676,
+   690,  694,  689,  692,  692,  682,  692,  696,  684,  683,  681,  702,
+   687,  691,  690,  695,  697,  684,  689,  687,  683,  686,  676,  681,
+   691,  686,  679,  677,  679,  680,  673,  692,  688,  686,  685,  683,
+   681,  684,  677,  679,  690,  683,  690,  692,  682,  685,  675,  677,
+   684,  684,  694,  681,  684,  690,  684,  682,  676,  684,  672,  686,
+   686,  685,  683,  682,  693,  690,  677,  683,  685,  680,  683,  684,
+   685,  687,  677,  686,  683,  684,  677,  686,  682,  681,  699,  682,
+   684,  689,  692,  685,  683,  689,  680,  685,  686,  691,  695,  684,
+   681,  686,  683,  688,  684,  680,  687,  688,  682,  691,  681,  677,
+   675,  684,  693,  686,  671,  682,  682,  687,  682,  675,  682,  689,
+   691,  691,  695,  691,  692,  683,  685,  692,  682,  691,  688,  689,
+   689,  688,  697,  688,  689,  703,  685,  693,  692,  689,  686,  681,
+   696,  690,  693,  696,  699,  685,  697,  682,  689,  692,  686,  693,
+   689,  697,  692,  680,  688,  687,  694,  677,  682,  686,  696,  680,
+   683,  691,  685,  691,  682,  688,  687,  679,  695,  687,  680,  683,
+   682,  684,  686,  677,  686,  681,  672,  686,  675,  688,  683,  680,
+   673,  688,  679,  685,  708,  683,  686,  687,  678,  682,  696,  688,
+   689,  683,  692,  699,  700,  691,  692,  691,  703,  688,  687,  692,
+   681,  685,  693,  682,  680,  681,  692,  674,  678,  687,  686,  689,
+   689,  688,  671,  685,  683,  684,  681,  677,  671,  679,  682,  681,
+   689,  691,  697,  699,  692,  693,  692,  696,  695,  681,  681,  678,
+   685,  687,  686,  678,  687,  689,  686,  693,  686,  689,  688,  690,
+   679,  692,  688,  685,  698,  694,  688,  694,  693,  683,  684,  690,
+   705,  684,  690,  687,  684,  691,  693,  694,  695,  701,  679,  684,
+   685,  695,  683,  692,  684,  679,  677,  687,  679,  693,  692,  677,
+   690,  678,  678,  693,  683,  695,  684,  687,  677,  698,  693,  681,
+   677,  689,  690,  688,  677,  682,  693,  694,  697,  688,  685,  678,
+   689,  684,  678,  695,  678,  679,  676,  679,  687,  676,  684,  686,
+   686,  675,  691,  678,  676,  691,  679,  683,  683,  679,  682,  681,
+   674,  679,  675,  687,  678,  673,  665,  685,  688,  676,  682,  680,
+   677,  679,  669,  681,  689,  686,  683,  679,  684,  678,  678,  686,
+   678,  694,  686,  665,  680,  676,  681,  665,  661,  671,  678,  685,
+   677,  681,  671,  686,  681,  671,  679,  681,  682,  682,  680,  686,
+   682,  677,  681,  674,  677,  682,  687,  680,  684,  683,  683,  686,
+   676,  680,  680,  678,  688,  682,  688,  680,  678,  681,  688,  678,
+   685,  685,  684,  679,  686,  677,  679,  691,  679,  674,  682,  683,
+   680,  677,  675,  666,  683,  680,  684,  674,  679,  677,  695,  673,
+   675,  694,  677,  680,  683,  685,  673,  684,  671,  679,  672,  679,
+   674,  678,  674,  679,  674,  673,  676,  680,  671,  673,  680,  674,
+   682,  663,  679,  674,  677,  660,  679,  689,  682,  667,  680,  682,
+   681,  668,  678,  673,  678,  669,  679,  677,  679,  681,  672,  673,
+   678,  690,  673,  678,  677,  682,  672,  662,  676,  674,  680,  685,
+   681,  677,  680,  670,  677,  677,  679,  684,  673,  678,  678,  677,
+   667,  677,  685,  679,  679,  677,  679,  685,  679,  657,  668,  672,
+   669,  673,  675,  676,  674,  680,  681,  682,  680,  674,  674,  680,
+   680,  669,  684,  660,  675,  669,  670,  676,  674,  675,  674,  671,
+   676,  666,  673,  672,  681,  685,  680,  683,  683,  667,  689,  677,
+   686,  679,  670,  680,  683,  661,  676,  669,  679,  672,  672,  668,
+   676,  674,  674,  681,  663,  682,  673,  675,  676,  674,  673,  672,
+   681,  665,  669,  680,  674,  674,  672,  666,  689,  667,  669,  683,
+   650,  667,  680,  676,  669,  674,  672,  664,  670,  668,  675,  671,
+   679,  670,  661,  678,  682,  662,  666,  668,  662,  669,  670,  683,
+   672,  678,  678,  670,  669,  671,  668,  666,  674,  671,  667,  675,
+   678,  680,  671,  676,  664,  669,  673,
+};
+
+#endif // GASGUARD_TRACE_DATA_H
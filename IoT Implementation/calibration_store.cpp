@@ -0,0 +1,114 @@
+/**
+ * GasGuard - Persistent Calibration Store (implementation)
+ *
+ * Uses the ESP32 Preferences/NVS API. The blob is versioned so a
+ * future layout change (e.g. adding temperature at calibration time)
+ * invalidates old blobs cleanly instead of misreading them.
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#include "calibration_store.h"
+
+#define CAL_NAMESPACE "gasguard"
+#define CAL_KEY       "cal"
+#define CAL_MAGIC     0x47474331u   // "GGC1"
+#define CAL_VERSION   1
+
+struct CalibrationBlob {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t reserved;
+  float r0[CALIBRATION_CHANNELS];
+};
+
+static float cachedR0[CALIBRATION_CHANNELS] = { 10.0f, 10.0f, 10.0f, 10.0f };
+static float driftTrim[CALIBRATION_CHANNELS] = { 1.0f, 1.0f, 1.0f, 1.0f };
+static bool storedValues = false;
+
+void calibrationBegin(const float defaults[CALIBRATION_CHANNELS]) {
+  for (int i = 0; i < CALIBRATION_CHANNELS; i++) {
+    cachedR0[i] = defaults[i];
+  }
+  storedValues = false;
+
+  Preferences prefs;
+  if (!prefs.begin(CAL_NAMESPACE, /*readOnly=*/true)) {
+    Serial.println("⚠️  Calibration: NVS unavailable, using defaults");
+    return;
+  }
+
+  CalibrationBlob blob = {};
+  size_t got = prefs.getBytes(CAL_KEY, &blob, sizeof(blob));
+  prefs.end();
+
+  if (got != sizeof(blob) || blob.magic != CAL_MAGIC ||
+      blob.version != CAL_VERSION) {
+    Serial.println("📝 Calibration: no stored R0, using defaults "
+                   "(run calibrateSensors() in clean air)");
+    return;
+  }
+
+  for (int i = 0; i < CALIBRATION_CHANNELS; i++) {
+    // Guard against corrupt/absurd values ending up on the hot path
+    if (blob.r0[i] > 0.1f && blob.r0[i] < 1000.0f) {
+      cachedR0[i] = blob.r0[i];
+    }
+  }
+  storedValues = true;
+
+  Serial.printf("✅ Calibration loaded: R0 = %.2f / %.2f / %.2f / %.2f kΩ\n",
+                cachedR0[0], cachedR0[1], cachedR0[2], cachedR0[3]);
+}
+
+bool calibrationSave(const float r0[CALIBRATION_CHANNELS]) {
+  CalibrationBlob blob = {};
+  blob.magic = CAL_MAGIC;
+  blob.version = CAL_VERSION;
+  for (int i = 0; i < CALIBRATION_CHANNELS; i++) {
+    blob.r0[i] = r0[i];
+    cachedR0[i] = r0[i];   // Take effect immediately, even if NVS fails
+  }
+  storedValues = true;
+
+  Preferences prefs;
+  if (!prefs.begin(CAL_NAMESPACE, /*readOnly=*/false)) {
+    return false;
+  }
+
+  size_t written = prefs.putBytes(CAL_KEY, &blob, sizeof(blob));
+  prefs.end();
+
+  return written == sizeof(blob);
+}
+
+void calibrationSeed(const float r0[CALIBRATION_CHANNELS]) {
+  for (int i = 0; i < CALIBRATION_CHANNELS; i++) {
+    if (r0[i] > 0.1f && r0[i] < 1000.0f) {
+      cachedR0[i] = r0[i];
+    }
+  }
+  storedValues = true;
+}
+
+float calibrationR0(int channel) {
+  if (channel < 0 || channel >= CALIBRATION_CHANNELS) channel = 0;
+  return cachedR0[channel] * driftTrim[channel];
+}
+
+void calibrationSetDriftTrim(int channel, float trim) {
+  if (channel < 0 || channel >= CALIBRATION_CHANNELS) return;
+  if (trim < 1.0f - CALIBRATION_MAX_TRIM) trim = 1.0f - CALIBRATION_MAX_TRIM;
+  if (trim > 1.0f + CALIBRATION_MAX_TRIM) trim = 1.0f + CALIBRATION_MAX_TRIM;
+  driftTrim[channel] = trim;
+}
+
+float calibrationDriftTrim(int channel) {
+  if (channel < 0 || channel >= CALIBRATION_CHANNELS) channel = 0;
+  return driftTrim[channel];
+}
+
+bool calibrationIsStored() {
+  return storedValues;
+}
@@ -0,0 +1,67 @@
+/**
+ * GasGuard - Persistent Calibration Store
+ *
+ * Replaces the edit-recompile R0 workflow: calibrateSensors() used to
+ * print R0 values for the operator to paste into #defines and reflash
+ * every node. Calibration now persists to NVS as a small versioned
+ * binary blob, loads in milliseconds during setup(), and the conversion
+ * path reads R0 from here — so recalibration is a runtime command, not
+ * a rebuild, and all 400 nodes can carry per-device values.
+ *
+ * Channel indices follow the scheduler order (SCHED_CH_* in
+ * sampling_scheduler.h): 0=MQ-4, 1=MQ-6, 2=MQ-7, 3=MQ-136.
+ */
+
+#ifndef GASGUARD_CALIBRATION_STORE_H
+#define GASGUARD_CALIBRATION_STORE_H
+
+#include <stddef.h>
+
+#define CALIBRATION_CHANNELS 4
+
+/**
+ * Load stored calibration from NVS into the RAM cache, falling back to
+ * `defaults` (the compile-time R0 constants) when nothing is stored or
+ * the blob version doesn't match. Milliseconds; call early in setup().
+ */
+void calibrationBegin(const float defaults[CALIBRATION_CHANNELS]);
+
+/**
+ * Persist a new set of R0 values and update the RAM cache. Returns
+ * false if the NVS write failed (the cache is updated regardless, so
+ * the running session still uses the new values).
+ */
+bool calibrationSave(const float r0[CALIBRATION_CHANNELS]);
+
+/**
+ * Seed the RAM cache directly without touching NVS. Used on warm wakes
+ * from deep sleep, where the R0 values carried in RTC memory make the
+ * NVS read unnecessary.
+ */
+void calibrationSeed(const float r0[CALIBRATION_CHANNELS]);
+
+/**
+ * R0 (kΩ) for a channel, with the health engine's drift trim applied.
+ * Reads the RAM cache — O(1), safe on the hot path. Out-of-range
+ * channels return the channel-0 value.
+ */
+float calibrationR0(int channel);
+
+/**
+ * Multiplicative drift trim on top of the stored R0, owned by the
+ * sensor-health engine (sensor_health.h). RAM-only — never persisted,
+ * so a reboot always restarts from the true calibration. Clamped to
+ * ±CALIBRATION_MAX_TRIM; 1.0 disables.
+ */
+#define CALIBRATION_MAX_TRIM 0.10f
+
+void calibrationSetDriftTrim(int channel, float trim);
+float calibrationDriftTrim(int channel);
+
+/**
+ * True if the running values came from NVS rather than the
+ * compile-time defaults.
+ */
+bool calibrationIsStored();
+
+#endif // GASGUARD_CALIBRATION_STORE_H
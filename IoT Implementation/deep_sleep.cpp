@@ -0,0 +1,106 @@
+/**
+ * GasGuard - Deep-Sleep Duty Cycling (implementation)
+ *
+ * One RTC_DATA_ATTR image holds everything a wake needs to resume warm:
+ * filter means/variances, the R0 cache, and the anomaly gate window.
+ * The image is magic-tagged and only trusted on a timer wake — a cold
+ * boot, a panic reset, or a layout change all fall back to the normal
+ * cold-start path.
+ */
+
+#include <Arduino.h>
+#include <esp_sleep.h>
+
+#include "deep_sleep.h"
+#include "adc_sampler.h"
+#include "calibration_store.h"
+#include "firmware_tasks.h"
+#include "anomaly_gate.h"
+
+#define SLEEP_MAGIC 0x47475331u   // "GGS1"
+
+struct RtcSamplingState {
+  uint32_t magic;
+  uint32_t bootCount;
+  float filterMean[CALIBRATION_CHANNELS];
+  float filterVariance[CALIBRATION_CHANNELS];
+  bool filterPrimed[CALIBRATION_CHANNELS];
+  float r0[CALIBRATION_CHANNELS];
+  AnomalyGateState gate;
+};
+
+// Survives deep sleep; cleared only by power loss / full reset
+static RTC_DATA_ATTR RtcSamplingState rtcState;
+
+static int statePins[CALIBRATION_CHANNELS];
+static size_t statePinCount = 0;
+
+bool deepSleepBegin(const int *pins, size_t numPins) {
+  if (numPins > CALIBRATION_CHANNELS) numPins = CALIBRATION_CHANNELS;
+  for (size_t i = 0; i < numPins; i++) {
+    statePins[i] = pins[i];
+  }
+  statePinCount = numPins;
+
+  bool timerWake =
+      esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+
+  if (!timerWake || rtcState.magic != SLEEP_MAGIC) {
+    // Cold boot (or untrusted image): start a fresh RTC image
+    rtcState.magic = 0;
+    rtcState.bootCount = 0;
+    return false;
+  }
+
+  rtcState.bootCount++;
+
+  // Warm resume: primed filters mean the first DMA chunk lands on a
+  // converged estimate — no multi-second warm-up before valid readings
+  for (size_t i = 0; i < numPins; i++) {
+    if (rtcState.filterPrimed[i]) {
+      adcSamplerSeedFilter(statePins[i], rtcState.filterMean[i],
+                           rtcState.filterVariance[i]);
+    }
+  }
+
+  // R0 cache from RTC; skips the NVS read entirely on warm wakes
+  calibrationSeed(rtcState.r0);
+
+  // Gate resumes mid-trend instead of transmitting blind after wake
+  firmwareAnomalyGate().importState(rtcState.gate);
+
+  Serial.printf("⏰ Warm wake #%u: filters, R0 and gate window restored\n",
+                rtcState.bootCount);
+  return true;
+}
+
+void deepSleepEnter() {
+  for (size_t i = 0; i < statePinCount; i++) {
+    rtcState.filterPrimed[i] = adcSamplerExportFilter(
+        statePins[i], &rtcState.filterMean[i], &rtcState.filterVariance[i]);
+  }
+  for (int i = 0; i < CALIBRATION_CHANNELS; i++) {
+    rtcState.r0[i] = calibrationR0(i);
+  }
+  firmwareAnomalyGate().exportState(rtcState.gate);
+  rtcState.magic = SLEEP_MAGIC;
+
+  // Sleep the remainder of the interval (never less than half of it,
+  // so a slow burst can't collapse the duty cycle)
+  uint64_t awakeUs = (uint64_t)millis() * 1000ULL;
+  uint64_t intervalUs = (uint64_t)DEEP_SLEEP_INTERVAL_SEC * 1000000ULL;
+  uint64_t sleepUs = awakeUs < intervalUs / 2 ? intervalUs - awakeUs
+                                              : intervalUs / 2;
+
+  Serial.printf("😴 Deep sleep for %llu s (burst took %lu ms)\n",
+                sleepUs / 1000000ULL, millis());
+  Serial.flush();
+
+  adcSamplerEnd();
+  esp_sleep_enable_timer_wakeup(sleepUs);
+  esp_deep_sleep_start();
+}
+
+uint32_t deepSleepBootCount() {
+  return rtcState.magic == SLEEP_MAGIC ? rtcState.bootCount : 0;
+}
@@ -0,0 +1,61 @@
+/**
+ * GasGuard - Deep-Sleep Duty Cycling for Battery Nodes
+ *
+ * Remote battery nodes can't run the continuous pipeline; they wake,
+ * sample a short burst, uplink, and deep-sleep for minutes. The naive
+ * version of that pays the full cold-start cost on every wake: the
+ * streaming filters re-prime from scratch and the anomaly gate's
+ * LSTM-mirror window is empty, so the first snapshots after wake are
+ * unfiltered and ungated.
+ *
+ * This module carries the warm state across sleep in RTC slow memory
+ * (RTC_DATA_ATTR survives deep sleep; only power loss clears it):
+ *
+ *   - per-channel StreamFilter mean/variance, re-seeded into the DMA
+ *     engine's filters so the first DMA chunk lands on a primed filter
+ *   - the calibration R0 cache, so NVS is not touched on warm wakes
+ *   - the anomaly gate's 10-snapshot window, so trend gating resumes
+ *     mid-trend instead of transmitting blind
+ *
+ * A warm wake is therefore <100 ms to the first valid GasReadings —
+ * I2S driver bring-up plus one DMA chunk — instead of a multi-second
+ * filter warm-up. At a fixed battery budget that resume time directly
+ * sets how many sampling bursts per day the node affords.
+ *
+ * Enabled per build via GASGUARD_DEEP_SLEEP in sensor_ppm_converter.cpp.
+ */
+
+#ifndef GASGUARD_DEEP_SLEEP_H
+#define GASGUARD_DEEP_SLEEP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Duty cycle: stay awake long enough for the burst (sample, classify,
+// ship one frame), then sleep the remainder of the interval
+#define DEEP_SLEEP_AWAKE_MS       5000
+#define DEEP_SLEEP_INTERVAL_SEC   300
+
+/**
+ * Restore warm state from RTC memory if this is a timer wake with a
+ * valid saved image. Call from setup() after adcSamplerBegin() and
+ * calibrationBegin(), before firmwareTasksBegin(). `pins` is the same
+ * pin array handed to the sampler, in SCHED_CH_* order.
+ *
+ * Returns true on a warm resume (filters, R0 cache and gate window
+ * restored), false on a cold boot (normal warm-up applies).
+ */
+bool deepSleepBegin(const int *pins, size_t numPins);
+
+/**
+ * Capture the live state into RTC memory and enter deep sleep for the
+ * remainder of DEEP_SLEEP_INTERVAL_SEC. Does not return.
+ */
+void deepSleepEnter();
+
+/**
+ * Wakes since the last cold boot (diagnostics/heartbeat).
+ */
+uint32_t deepSleepBootCount();
+
+#endif // GASGUARD_DEEP_SLEEP_H
@@ -0,0 +1,66 @@
+/**
+ * GasGuard - Temperature/Humidity Compensation Stage (implementation)
+ *
+ * Per-family fit coefficients below are derived from the temperature/
+ * humidity dependence plots in the Hanwei datasheets referenced at the
+ * bottom of sensor_ppm_converter.cpp: Rs rises in cold/dry air and
+ * falls in hot/humid air, steepest for the MQ-7 and mildest for the
+ * MQ-4. Recalibrating the fits only requires editing the coefficients;
+ * the tables rebuild at compile time.
+ */
+
+#include "env_compensation.h"
+
+// One surface per channel, SCHED_CH_* order (MQ-4, MQ-6, MQ-7, MQ-136)
+static constexpr EnvCorrection CORRECTIONS[4] = {
+  envCorrectionBuild(1.28, -0.016, 1.6e-4, -1.6e-3, 6.0e-6),   // MQ-4
+  envCorrectionBuild(1.32, -0.018, 1.8e-4, -1.8e-3, 7.0e-6),   // MQ-6
+  envCorrectionBuild(1.40, -0.022, 2.2e-4, -2.4e-3, 9.0e-6),   // MQ-7
+  envCorrectionBuild(1.34, -0.019, 1.9e-4, -2.0e-3, 8.0e-6),   // MQ-136
+};
+
+static float ambientTempC = 20.0f;
+static float ambientRH = 65.0f;
+static bool conditionsSet = false;
+
+/**
+ * Bilinear interpolation on one surface, clamped to the grid edges
+ */
+static float surfaceLookup(const EnvCorrection &corr, float t, float rh) {
+  float ti = (t - ENV_T_MIN) / ENV_T_STEP;
+  float hi = (rh - ENV_RH_MIN) / ENV_RH_STEP;
+
+  if (ti < 0) ti = 0;
+  if (ti > ENV_T_POINTS - 1) ti = ENV_T_POINTS - 1;
+  if (hi < 0) hi = 0;
+  if (hi > ENV_RH_POINTS - 1) hi = ENV_RH_POINTS - 1;
+
+  int t0 = (int)ti;
+  int h0 = (int)hi;
+  int t1 = t0 < ENV_T_POINTS - 1 ? t0 + 1 : t0;
+  int h1 = h0 < ENV_RH_POINTS - 1 ? h0 + 1 : h0;
+  float tf = ti - t0;
+  float hf = hi - h0;
+
+  float lo = corr.factor[t0][h0] + (corr.factor[t0][h1] - corr.factor[t0][h0]) * hf;
+  float hiRow = corr.factor[t1][h0] + (corr.factor[t1][h1] - corr.factor[t1][h0]) * hf;
+  return lo + (hiRow - lo) * tf;
+}
+
+void envCompensationSet(float tempC, float relHumidity) {
+  ambientTempC = tempC;
+  ambientRH = relHumidity;
+  conditionsSet = true;
+}
+
+float envCompensateRs(int channel, float Rs) {
+  if (!conditionsSet || Rs <= 0) return Rs;
+  if (channel < 0 || channel > 3) return Rs;
+
+  return Rs / surfaceLookup(CORRECTIONS[channel], ambientTempC, ambientRH);
+}
+
+float envCompensationFactor(int channel) {
+  if (!conditionsSet || channel < 0 || channel > 3) return 1.0f;
+  return surfaceLookup(CORRECTIONS[channel], ambientTempC, ambientRH);
+}
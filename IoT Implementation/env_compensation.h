@@ -0,0 +1,85 @@
+/**
+ * GasGuard - Temperature/Humidity Compensation Stage
+ *
+ * MQ sensor resistance drifts ±20% with ambient temperature and
+ * humidity (see the notes block in sensor_ppm_converter.cpp). This
+ * stage sits between calculateRs() and the PPM conversion and divides
+ * the measured Rs by a correction factor representing the sensor's
+ * clean-response drift at the current ambient conditions, so the Rs/R0
+ * ratio the conversion sees is referenced back to the datasheet's
+ * 20 °C / 65% RH conditions.
+ *
+ * The datasheet dependence curves are fitted per sensor family as a
+ * quadratic-in-T, linear-in-RH surface and baked at compile time into
+ * small 2-D tables (13 temperature x 8 humidity points, ~416 bytes per
+ * sensor). Runtime cost is one bilinear interpolation — two lerps —
+ * per reading, with no polynomial evaluation on the hot path.
+ *
+ * Ambient conditions come from envCompensationSet() (an on-board
+ * DHT22/BME280 when fitted, otherwise zone values pushed from the
+ * backend's `environmental` data). Until set, the factor is 1.0 and
+ * behaviour is identical to the uncompensated pipeline.
+ */
+
+#ifndef GASGUARD_ENV_COMPENSATION_H
+#define GASGUARD_ENV_COMPENSATION_H
+
+// Table grid: T in [-10, 50] °C step 5, RH in [20, 90] % step 10
+#define ENV_T_MIN     (-10.0f)
+#define ENV_T_STEP    5.0f
+#define ENV_T_POINTS  13
+#define ENV_RH_MIN    20.0f
+#define ENV_RH_STEP   10.0f
+#define ENV_RH_POINTS 8
+
+struct EnvCorrection {
+  float factor[ENV_T_POINTS][ENV_RH_POINTS];
+};
+
+/**
+ * Build one correction surface at compile time from fit coefficients:
+ *
+ *   f(T, RH) = c0 + c1*T + c2*T^2 + (RH - 65) * (d0 + d1*T)
+ *
+ * normalized so f(20, 65) == 1. Coefficients come from fitting the
+ * datasheet temperature/humidity dependence plots (Rs/Rs0 at 33% and
+ * 85% RH) for each sensor family.
+ */
+constexpr EnvCorrection envCorrectionBuild(double c0, double c1, double c2,
+                                           double d0, double d1) {
+  EnvCorrection corr = {};
+
+  double ref = c0 + c1 * 20.0 + c2 * 400.0;   // f at 20 °C / 65% RH
+
+  for (int ti = 0; ti < ENV_T_POINTS; ti++) {
+    double t = ENV_T_MIN + ti * ENV_T_STEP;
+    for (int hi = 0; hi < ENV_RH_POINTS; hi++) {
+      double rh = ENV_RH_MIN + hi * ENV_RH_STEP;
+      double f = (c0 + c1 * t + c2 * t * t + (rh - 65.0) * (d0 + d1 * t)) / ref;
+      // Clamp to the ±35% band — beyond that the fit is extrapolating
+      if (f < 0.65) f = 0.65;
+      if (f > 1.35) f = 1.35;
+      corr.factor[ti][hi] = (float)f;
+    }
+  }
+  return corr;
+}
+
+/**
+ * Set the ambient conditions used for all subsequent readings.
+ */
+void envCompensationSet(float tempC, float relHumidity);
+
+/**
+ * Compensate a measured Rs for the current ambient conditions.
+ * `channel` uses the SCHED_CH_* order. Two lerps; returns Rs unchanged
+ * (factor 1.0) until conditions have been set.
+ */
+float envCompensateRs(int channel, float Rs);
+
+/**
+ * Current correction factor for a channel (diagnostics/heartbeat).
+ */
+float envCompensationFactor(int channel);
+
+#endif // GASGUARD_ENV_COMPENSATION_H
@@ -0,0 +1,319 @@
+/**
+ * GasGuard - ESP-NOW Zone Relay (implementation)
+ *
+ * Leaves broadcast to FF:FF:FF:FF:FF:FF — no pairing step, and a
+ * replacement gateway hears the zone immediately. The gateway's
+ * receive callback runs in the Wi-Fi task, so it only copies the frame
+ * into a lock-free ring; batching and the MQTT publish happen in a
+ * separate relay task (same producer/consumer split as the snapshot
+ * path in firmware_tasks.cpp).
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_now.h>
+
+#include "espnow_relay.h"
+#include "spsc_ring.h"
+#include "firmware_tasks.h"
+#include "risk_classifier.h"
+#include "mqtt_uplink.h"
+#include "batch_convert.h"
+#include "adc_sampler.h"
+#include "calibration_store.h"
+
+// Conversion curve constants (sensor_ppm_converter.cpp), SCHED_CH_*
+// order — the gateway converts raw leaf frames with the same curves
+// the leaves would have used
+static constexpr double CURVE_A[4] = { 1012.0, 1009.0, 99.042, 44.947 };
+static constexpr double CURVE_B[4] = { -2.786, -2.35, -1.518, -3.445 };
+
+static const uint8_t BROADCAST_MAC[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+static bool relayRunning = false;
+static uint8_t leafNodeId = 0;
+static uint8_t leafSeq = 0;
+static uint32_t frameCount = 0;
+
+// Gateway: Wi-Fi task produces, relay task consumes
+static SpscRing<EspNowFrame, ESPNOW_RX_RING_SIZE> rxRing;
+static SpscRing<EspNowRawFrame, ESPNOW_RX_RING_SIZE> rawRing;
+
+// Raw-leaf sensor pins (SCHED_CH_* order)
+static int rawPins[4];
+static size_t rawPinCount = 0;
+
+static bool espnowCommonInit() {
+  // ESP-NOW rides on the STA interface; no association required
+  WiFi.mode(WIFI_STA);
+  WiFi.disconnect();
+
+  if (esp_now_init() != ESP_OK) {
+    Serial.println("❌ ESP-NOW: init failed");
+    return false;
+  }
+  return true;
+}
+
+// ============================================================================
+// LEAF ROLE
+// ============================================================================
+
+static void leafTask(void *arg) {
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    GasReadings r = firmwareTasksLatest();
+
+    if (r.valid) {
+      EspNowFrame frame = {};
+      frame.magic = ESPNOW_FRAME_MAGIC;
+      frame.nodeId = leafNodeId;
+      frame.seq = leafSeq++;
+      frame.risk = (uint8_t)classifyReadings(r);
+      frame.valid = 1;
+      frame.uptimeMs = millis();
+      frame.methane = (int32_t)(r.methane * 100.0f);
+      frame.lpg = (int32_t)(r.lpg * 100.0f);
+      frame.carbonMonoxide = (int32_t)(r.carbonMonoxide * 100.0f);
+      frame.hydrogenSulfide = (int32_t)(r.hydrogenSulfide * 100.0f);
+
+      if (esp_now_send(BROADCAST_MAC, (const uint8_t *)&frame,
+                       sizeof(frame)) == ESP_OK) {
+        frameCount++;
+      }
+    }
+
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(ESPNOW_LEAF_PERIOD_MS));
+  }
+}
+
+/**
+ * Raw variant: no conversion on the leaf at all — just the filtered
+ * counts straight off the DMA engine's stream filters
+ */
+static void leafRawTask(void *arg) {
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    EspNowRawFrame frame = {};
+    frame.magic = ESPNOW_RAW_MAGIC;
+    frame.nodeId = leafNodeId;
+    frame.seq = leafSeq++;
+
+    bool allValid = true;
+    for (size_t ch = 0; ch < rawPinCount; ch++) {
+      float counts = adcSamplerFilteredCounts(rawPins[ch]);
+      if (counts < 0) {
+        allValid = false;
+        break;
+      }
+      frame.counts[ch] = (uint16_t)counts;
+    }
+
+    if (allValid && esp_now_send(BROADCAST_MAC, (const uint8_t *)&frame,
+                                 sizeof(frame)) == ESP_OK) {
+      frameCount++;
+    }
+
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(ESPNOW_LEAF_PERIOD_MS));
+  }
+}
+
+static bool leafCommonBegin(uint8_t nodeId) {
+  if (relayRunning || !espnowCommonInit()) return false;
+
+  esp_now_peer_info_t peer = {};
+  memcpy(peer.peer_addr, BROADCAST_MAC, 6);
+  peer.channel = 0;   // current channel
+  peer.encrypt = false;
+  if (esp_now_add_peer(&peer) != ESP_OK) {
+    Serial.println("❌ ESP-NOW: add broadcast peer failed");
+    return false;
+  }
+
+  leafNodeId = nodeId;
+  relayRunning = true;
+  return true;
+}
+
+bool espnowRelayBeginLeaf(uint8_t nodeId) {
+  if (!leafCommonBegin(nodeId)) return false;
+
+  xTaskCreate(leafTask, "gg_leaf", 2048, NULL, 2, NULL);
+
+  Serial.printf("✅ ESP-NOW leaf %u: broadcasting every %d ms\n",
+                nodeId, ESPNOW_LEAF_PERIOD_MS);
+  return true;
+}
+
+bool espnowRelayBeginLeafRaw(uint8_t nodeId, const int *pins,
+                             size_t numPins) {
+  if (numPins > 4) numPins = 4;
+  for (size_t i = 0; i < numPins; i++) rawPins[i] = pins[i];
+  rawPinCount = numPins;
+
+  if (!leafCommonBegin(nodeId)) return false;
+
+  xTaskCreate(leafRawTask, "gg_leaf", 2048, NULL, 2, NULL);
+
+  Serial.printf("✅ ESP-NOW raw leaf %u: counts every %d ms\n",
+                nodeId, ESPNOW_LEAF_PERIOD_MS);
+  return true;
+}
+
+// ============================================================================
+// GATEWAY ROLE
+// ============================================================================
+
+/**
+ * Wi-Fi task context: copy into the ring and get out
+ */
+static void gatewayRecvCallback(const uint8_t *mac, const uint8_t *data,
+                                int len) {
+  if (len == sizeof(EspNowFrame)) {
+    EspNowFrame frame;
+    memcpy(&frame, data, sizeof(frame));
+    if (frame.magic == ESPNOW_FRAME_MAGIC) rxRing.publish(frame);
+  } else if (len == sizeof(EspNowRawFrame)) {
+    EspNowRawFrame frame;
+    memcpy(&frame, data, sizeof(frame));
+    if (frame.magic == ESPNOW_RAW_MAGIC) rawRing.publish(frame);
+  }
+}
+
+/**
+ * Drain pending raw-counts frames, batch-convert them through the SoA
+ * kernel, and append the results to the PPM batch. One kernel call per
+ * channel per tick covers every raw leaf in the zone.
+ */
+static size_t gatewayConvertRawFrames(EspNowFrame *batch, size_t batched) {
+  static PpmLut luts[4];
+  static bool lutsBuilt = false;
+  if (!lutsBuilt) {
+    for (int ch = 0; ch < 4; ch++) {
+      luts[ch] = ppmLutBuild(CURVE_A[ch], CURVE_B[ch]);
+    }
+    lutsBuilt = true;
+  }
+
+  // SoA staging: column-per-channel counts for the pending raw frames
+  EspNowRawFrame raw[ESPNOW_BATCH_FRAMES];
+  uint16_t counts[4][ESPNOW_BATCH_FRAMES];
+  size_t n = 0;
+  while (n < ESPNOW_BATCH_FRAMES - batched && rawRing.consume(raw[n])) {
+    for (int ch = 0; ch < 4; ch++) counts[ch][n] = raw[n].counts[ch];
+    n++;
+  }
+  if (n == 0) return batched;
+
+  float ppm[4][ESPNOW_BATCH_FRAMES];
+  float r0[4];
+  float *ppmOut[4];
+  BatchCountsFrame soa;
+  for (int ch = 0; ch < 4; ch++) {
+    soa.counts[ch] = counts[ch];
+    ppmOut[ch] = ppm[ch];
+    r0[ch] = calibrationR0(ch);   // gateway calibration stands in for
+                                  // leaves that ship raw counts
+  }
+  soa.n = n;
+  batchConvertFrame(soa, luts, r0, ppmOut);
+
+  for (size_t i = 0; i < n; i++) {
+    GasReadings r;
+    r.methane = ppm[0][i];
+    r.lpg = ppm[1][i];
+    r.carbonMonoxide = ppm[2][i];
+    r.hydrogenSulfide = ppm[3][i];
+    r.valid = true;
+
+    EspNowFrame &out = batch[batched++];
+    out.magic = ESPNOW_FRAME_MAGIC;
+    out.nodeId = raw[i].nodeId;
+    out.seq = raw[i].seq;
+    out.risk = (uint8_t)classifyReadings(r);
+    out.valid = 1;
+    out.uptimeMs = millis();
+    out.methane = (int32_t)(r.methane * 100.0f);
+    out.lpg = (int32_t)(r.lpg * 100.0f);
+    out.carbonMonoxide = (int32_t)(r.carbonMonoxide * 100.0f);
+    out.hydrogenSulfide = (int32_t)(r.hydrogenSulfide * 100.0f);
+    frameCount++;
+  }
+  return batched;
+}
+
+static void gatewayTask(void *arg) {
+  static EspNowFrame batch[ESPNOW_BATCH_FRAMES];
+  size_t batched = 0;
+  bool alertPending = false;   // sticky until the batch actually ships
+  uint32_t lastFlushMs = millis();
+
+  for (;;) {
+    EspNowFrame frame;
+    while (batched < ESPNOW_BATCH_FRAMES && rxRing.consume(frame)) {
+      batch[batched++] = frame;
+      frameCount++;
+
+      // A leaf reporting ALERT or worse flushes immediately — the
+      // batch timer must never sit on safety-critical data
+      if (frame.risk >= RISK_ALERT) {
+        alertPending = true;
+        break;
+      }
+    }
+
+    // Raw-counts leaves: one SoA kernel pass converts them all. Their
+    // risk is only known after conversion, so scan what was appended —
+    // a raw leaf can be the one seeing the leak
+    size_t converted = gatewayConvertRawFrames(batch, batched);
+    for (size_t i = batched; i < converted; i++) {
+      if (batch[i].risk >= RISK_ALERT) alertPending = true;
+    }
+    batched = converted;
+
+    bool flushDue = (millis() - lastFlushMs) >= ESPNOW_BATCH_FLUSH_MS;
+
+    if (batched > 0 && (batched == ESPNOW_BATCH_FRAMES || flushDue ||
+                        alertPending)) {
+      if (mqttUplinkPublishEvent("mesh", (const uint8_t *)batch,
+                                 batched * sizeof(EspNowFrame))) {
+        batched = 0;
+        alertPending = false;
+      }
+      // Link down: keep the batch (and any alert flag) and retry
+      lastFlushMs = millis();
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(50));
+  }
+}
+
+bool espnowRelayBeginGateway() {
+  if (relayRunning || !espnowCommonInit()) return false;
+
+  if (esp_now_register_recv_cb(gatewayRecvCallback) != ESP_OK) {
+    Serial.println("❌ ESP-NOW: recv callback registration failed");
+    return false;
+  }
+
+  relayRunning = true;
+  xTaskCreate(gatewayTask, "gg_gateway", 4096, NULL, 2, NULL);
+
+  Serial.printf("✅ ESP-NOW gateway: batching %d frames / %d ms\n",
+                ESPNOW_BATCH_FRAMES, ESPNOW_BATCH_FLUSH_MS);
+  return true;
+}
+
+// ============================================================================
+// DIAGNOSTICS
+// ============================================================================
+
+uint32_t espnowRelayFrameCount() {
+  return frameCount;
+}
+
+uint32_t espnowRelayDroppedFrames() {
+  return (uint32_t)rxRing.dropped();
+}
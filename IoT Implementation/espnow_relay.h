@@ -0,0 +1,109 @@
+/**
+ * GasGuard - ESP-NOW Zone Relay
+ *
+ * Zones run 8-12 nodes within meters of each other, and every one of
+ * them pays full Wi-Fi association plus TLS overhead to reach the
+ * backend individually. In relay mode only one node per zone — the
+ * gateway — keeps a backend connection; the rest become leaves that
+ * broadcast packed GasReadings frames over ESP-NOW (connectionless,
+ * ~1 ms over the air, no AP association) to the gateway, which
+ * aggregates and batch-uploads through the normal uplink path.
+ *
+ * Per-zone backend connections drop from 12 to 1, leaf radios only
+ * power up for a ~30-byte broadcast per reading, and leaf-to-gateway
+ * latency is lower than any node currently sees to the backend.
+ *
+ * Frames carry centi-PPM int32s (same fixed-point convention as the
+ * uplink codec) plus the local risk verdict, so the gateway can
+ * escalate on a leaf's ALERT without unpacking floats.
+ *
+ * Role is selected per build via GASGUARD_ESPNOW_MODE in
+ * sensor_ppm_converter.cpp.
+ */
+
+#ifndef GASGUARD_ESPNOW_RELAY_H
+#define GASGUARD_ESPNOW_RELAY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "gas_readings.h"
+
+// Leaf broadcast cadence (the gateway batches, so leaves stay simple)
+#define ESPNOW_LEAF_PERIOD_MS   1000
+
+// Gateway batching: upload when full or when the flush timer expires
+#define ESPNOW_BATCH_FRAMES     16
+#define ESPNOW_BATCH_FLUSH_MS   5000
+
+// Received-frame ring on the gateway (power of two)
+#define ESPNOW_RX_RING_SIZE     32
+
+#define ESPNOW_FRAME_MAGIC      0x47474E31u   // "GGN1"
+
+/**
+ * One leaf reading on the air. 32 bytes, well under the 250-byte
+ * ESP-NOW payload limit.
+ */
+struct EspNowFrame {
+  uint32_t magic;
+  uint8_t nodeId;        // leaf identity within the zone
+  uint8_t seq;           // per-leaf sequence for loss accounting
+  uint8_t risk;          // leaf's local RiskState verdict
+  uint8_t valid;         // GasReadings.valid
+  uint32_t uptimeMs;     // leaf millis() at capture
+  int32_t methane;       // centi-PPM
+  int32_t lpg;
+  int32_t carbonMonoxide;
+  int32_t hydrogenSulfide;
+};
+
+#define ESPNOW_RAW_MAGIC        0x47474E32u   // "GGN2"
+
+/**
+ * Raw-counts leaf frame: the leaf skips PPM conversion entirely and
+ * ships filtered ADC counts; the gateway batch-converts the whole
+ * zone per tick through the SoA kernel (batch_convert.h). 16 bytes on
+ * the air and no float math on the leaf.
+ */
+struct EspNowRawFrame {
+  uint32_t magic;
+  uint8_t nodeId;
+  uint8_t seq;
+  uint16_t reserved;
+  uint16_t counts[4];    // SCHED_CH_* order, 12-bit ADC counts
+};
+
+/**
+ * Leaf role: broadcast the latest processed snapshot every
+ * ESPNOW_LEAF_PERIOD_MS. `nodeId` distinguishes leaves within the
+ * zone (last octet of the node MAC works well).
+ */
+bool espnowRelayBeginLeaf(uint8_t nodeId);
+
+/**
+ * Raw-counts leaf role: broadcast filtered ADC counts instead of PPM,
+ * leaving conversion to the gateway. `pins` is the sensor pin array in
+ * SCHED_CH_* order.
+ */
+bool espnowRelayBeginLeafRaw(uint8_t nodeId, const int *pins,
+                             size_t numPins);
+
+/**
+ * Gateway role: receive leaf frames, batch them, and ship each batch
+ * through the MQTT uplink as a "mesh" event. The gateway's own
+ * readings continue through the normal pipeline unchanged.
+ */
+bool espnowRelayBeginGateway();
+
+/**
+ * Frames received (gateway) or sent (leaf) since begin.
+ */
+uint32_t espnowRelayFrameCount();
+
+/**
+ * Frames dropped because the gateway receive ring was full.
+ */
+uint32_t espnowRelayDroppedFrames();
+
+#endif // GASGUARD_ESPNOW_RELAY_H
@@ -0,0 +1,313 @@
+/**
+ * GasGuard - Dual-Core Task Split (implementation)
+ *
+ * Snapshots flow sampling task -> lock-free SPSC ring -> processing
+ * task (see spsc_ring.h). The sampler publishes unconditionally and
+ * never blocks; a stalled consumer loses only the oldest snapshots.
+ */
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "firmware_tasks.h"
+#include "uplink_codec.h"
+#include "risk_classifier.h"
+#include "adaptive_sampler.h"
+#include "gg_log.h"
+#include "mqtt_uplink.h"
+#include "anomaly_gate.h"
+#include "flight_recorder.h"
+#include "stage_timing.h"
+#include "flash_spool.h"
+#include "vent_control.h"
+#include "sensor_health.h"
+#include "adc_sampler.h"
+
+// Statically allocated — no heap, no mutexes (see spsc_ring.h)
+static SpscRing<GasReadings, TASKS_SNAPSHOT_RING_SIZE> snapshotRing;
+
+// Batched binary uplink frame under construction (see uplink_codec.h)
+static UplinkEncoder uplinkEncoder;
+
+// Keeps flat NORMAL traffic off the wire (see anomaly_gate.h)
+static AnomalyGate anomalyGate;
+
+// Flight-recorder upload progress (entries shipped so far)
+static size_t flightUploadOffset = 0;
+
+// Spool drain direction: the first block after a reconnect ships
+// newest-first (live relevance), the rest of the backlog oldest-first
+static bool linkWasUp = false;
+static bool drainNewestFirst = false;
+
+static TaskHandle_t samplingTaskHandle = NULL;
+static TaskHandle_t processingTaskHandle = NULL;
+static bool tasksStarted = false;
+
+// Latest snapshot, shared with the ESP-NOW leaf task and loop().
+// Guarded by a one-deep seqlock (odd sequence = writer mid-copy), the
+// same lock-free flavour as the snapshot ring: the writer never
+// blocks, readers retry the rare nanoseconds-wide collision.
+static GasReadings latestProcessed = {};
+static std::atomic<uint32_t> latestSeq{0};
+
+static void publishLatest(const GasReadings &readings) {
+  uint32_t s = latestSeq.load(std::memory_order_relaxed);
+  latestSeq.store(s + 1, std::memory_order_relaxed);   // mark odd
+  std::atomic_thread_fence(std::memory_order_release); // seq before data
+  latestProcessed = readings;
+  std::atomic_thread_fence(std::memory_order_release); // data before seq
+  latestSeq.store(s + 2, std::memory_order_relaxed);   // even: stable
+}
+
+/**
+ * Profile hook for the (platform-free) adaptive controller: on-device
+ * a profile change means a new ADC filter weight and a log line
+ */
+static void applySamplingProfile(float alpha, bool escalated) {
+  adcSamplerSetFilterAlpha(alpha);
+  if (escalated) {
+    Serial.printf("⏫ Sampling escalated to %d ms\n",
+                  ADAPTIVE_ACTIVE_PERIOD_MS);
+  } else {
+    Serial.printf("⏬ Sampling relaxed to %d ms\n", ADAPTIVE_IDLE_PERIOD_MS);
+  }
+}
+
+// ============================================================================
+// SAMPLING TASK (core 0)
+// ============================================================================
+
+/**
+ * Snapshot producer. vTaskDelayUntil keeps the cadence drift-free even
+ * if a snapshot occasionally takes longer; the cadence itself is set
+ * per-cycle by the adaptive controller — slow while NORMAL, 10 Hz the
+ * moment any channel leaves the NORMAL band (see adaptive_sampler.h).
+ */
+static void samplingTask(void *arg) {
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    uint32_t t = stageTimingStart();
+    GasReadings readings = readAllSensors();
+    stageTimingEnd(STAGE_ACQUIRE, t);
+
+    // Lock-free publish: never blocks, overwrites oldest when full
+    snapshotRing.publish(readings);
+
+    // Classification is microseconds of work, cheap enough to run
+    // here purely to steer the sampling cadence
+    uint32_t periodMs =
+        adaptiveSamplerUpdate(classifyReadings(readings), millis());
+
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(periodMs));
+  }
+}
+
+// ============================================================================
+// PROCESSING TASK (core 1)
+// ============================================================================
+
+/**
+ * Snapshot consumer: diagnostics now, filtering and backend transport
+ * as those stages land. Blocking here (e.g. a Wi-Fi retry) cannot
+ * affect the sampling task on the other core.
+ */
+static void processingTask(void *arg) {
+  GasReadings readings;
+
+  stageTimingBegin();
+
+  for (;;) {
+    // Drain the ring; a short sleep when empty keeps this core mostly
+    // idle. Idle is not wedged, so the watchdog still gets fed.
+    if (!snapshotRing.consume(readings)) {
+      stageTimingCycleComplete();
+      vTaskDelay(pdMS_TO_TICKS(20));
+      continue;
+    }
+
+    publishLatest(readings);
+
+    // Local fast path: classify against the backend's threshold table
+    // and step the ventilation controller within this sampling period —
+    // no network round trip on the safety-critical path (vent_control.h
+    // owns the relay pin, the debounce and the mode state machine)
+    uint32_t t = stageTimingStart();
+    RiskState risk = classifyReadings(readings);
+    ventControlUpdate(risk);
+    stageTimingEnd(STAGE_CLASSIFY, t);
+
+    // Baseline drift tracking: NORMAL cycles feed the clean-air EWMA,
+    // anything else is a single compare (see sensor_health.h)
+    sensorHealthUpdate(risk);
+
+    if (risk >= RISK_UNUSUAL) {
+      GGLOG(GGLOG_RISK_STATE, (uint16_t)risk, 0, 0);
+    }
+
+    // Freeze the flight recorder on ALERT so the pre-trigger history
+    // survives; the frozen ring is shipped in chunks below
+    if (risk >= RISK_ALERT && !flightRecorderFrozen()) {
+      flightRecorderFreeze();
+      flightUploadOffset = 0;
+      Serial.println("🛬 Flight recorder frozen (pre-trigger history held)");
+    }
+
+    // Chunked upload of the frozen history: a few chunks per cycle so
+    // live traffic still interleaves; resumes capture once done
+    if (flightRecorderFrozen()) {
+      FlightSample chunk[32];
+      for (int burst = 0; burst < 4; burst++) {
+        size_t n = flightRecorderRead(flightUploadOffset, chunk, 32);
+        if (n == 0) {
+          flightRecorderResume();
+          flightUploadOffset = 0;
+          break;
+        }
+        if (!mqttUplinkPublishEvent("flight", (const uint8_t *)chunk,
+                                    n * sizeof(FlightSample))) {
+          break;  // Link down: stay frozen, retry next cycle
+        }
+        flightUploadOffset += n;
+      }
+    }
+
+    if (readings.valid) {
+      // Per-cycle diagnostics via the deferred binary log channel
+      // (gg_log.h) — nothing here formats a float or blocks on UART
+      GGLOG(GGLOG_SNAPSHOT, 0,
+            (int32_t)(readings.methane * 100.0f),
+            (int32_t)(readings.lpg * 100.0f));
+      GGLOG(GGLOG_SNAPSHOT2, 0,
+            (int32_t)(readings.carbonMonoxide * 100.0f),
+            (int32_t)(readings.hydrogenSulfide * 100.0f));
+
+      // Uplink gating: flat NORMAL data stays off the wire entirely;
+      // anomalous data batches at full rate, and a once-a-minute
+      // heartbeat flushes whatever is pending so the backend sees the
+      // node alive (see anomaly_gate.h)
+      t = stageTimingStart();
+      AnomalyGateDecision decision =
+          anomalyGate.update(readings, risk, millis());
+
+      bool frameReady = false;
+      if (decision != GATE_SUPPRESS) {
+        frameReady = uplinkEncoder.addSnapshot(readings);
+      }
+      if (decision == GATE_HEARTBEAT && uplinkEncoder.snapshots() > 0) {
+        frameReady = true;  // ship the partial frame now
+      }
+      stageTimingEnd(STAGE_ENCODE, t);
+
+      if (frameReady) {
+        // Static-buffer publish over the persistent MQTT session;
+        // queues (never blocks) if the link is down
+        t = stageTimingStart();
+        mqttUplinkPublishFrame(uplinkEncoder.data(), uplinkEncoder.size());
+        stageTimingEnd(STAGE_TRANSMIT, t);
+        GGLOG(GGLOG_UPLINK_FRAME, uplinkEncoder.snapshots(),
+              (int32_t)uplinkEncoder.size(), 0);
+        uplinkEncoder.reset();
+      }
+
+      // Offline buffering: while the link is down every valid snapshot
+      // goes to the flash spool (sector-batched, so most appends are a
+      // memcpy); the anomaly gate keeps suppressing the wire but the
+      // spool keeps the trend history complete for backfill
+      if (!mqttUplinkConnected()) {
+        flashSpoolAppend(readings, (uint8_t)risk);
+      }
+
+      // Stage latency histograms ride the quiet-period heartbeat —
+      // fleet-wide p99 per stage without adding a single extra message
+      if (decision == GATE_HEARTBEAT) {
+        StageHistogram hist[STAGE_COUNT];
+        for (int s = 0; s < STAGE_COUNT; s++) {
+          hist[s] = *stageTimingHistogram((PipelineStage)s);
+        }
+        mqttUplinkPublishEvent("timing", (const uint8_t *)hist,
+                               sizeof(hist));
+
+        // ...as do the per-channel health scores and recalibration
+        // flags, so the fleet dashboard sees aging sensors early
+        SensorHealthReport health = sensorHealthReport();
+        mqttUplinkPublishEvent("health", (const uint8_t *)&health,
+                               sizeof(health));
+      }
+    }
+
+    // Spool drain: one block per cycle so backfill interleaves with
+    // live traffic. The block is only consumed after its publish
+    // succeeded — a mid-drain disconnect loses nothing.
+    bool linkUp = mqttUplinkConnected();
+    if (linkUp && !linkWasUp) {
+      drainNewestFirst = true;  // freshest context first after reconnect
+    }
+    linkWasUp = linkUp;
+
+    if (linkUp && flashSpoolBacklog() > 0) {
+      static SpoolRecord block[SPOOL_RECORDS_PER_BLOCK];
+      uint32_t blockSeq;
+      size_t n = flashSpoolReadBlock(block, drainNewestFirst, &blockSeq);
+      if (n > 0 && mqttUplinkPublishEvent("spool", (const uint8_t *)block,
+                                          n * sizeof(SpoolRecord))) {
+        flashSpoolConsume(blockSeq);
+        drainNewestFirst = false;
+      }
+    }
+
+    stageTimingCycleComplete();
+  }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void firmwareTasksBegin() {
+  if (tasksStarted) return;  // Already running
+  tasksStarted = true;
+
+  uplinkEncoder.reset();
+
+  ventControlBegin();
+  adaptiveSamplerOnProfileChange(applySamplingProfile);
+
+  GGLOG_BEGIN();
+
+  // Sampling on core 0, away from the Arduino/WiFi core
+  xTaskCreatePinnedToCore(samplingTask, "gg_sample", 4096, NULL,
+                          TASKS_SAMPLING_PRIORITY, &samplingTaskHandle, 0);
+
+  // Processing/transport on core 1 (the Arduino core)
+  xTaskCreatePinnedToCore(processingTask, "gg_process", 8192, NULL,
+                          TASKS_PROCESSING_PRIORITY, &processingTaskHandle, 1);
+
+  Serial.println("✅ Task split: sampling on core 0, processing on core 1");
+}
+
+GasReadings firmwareTasksLatest() {
+  // Seqlock read: accept only a copy bracketed by the same even
+  // sequence — a torn mix of two snapshots could classify as a
+  // phantom ALERT on the leaf broadcast path
+  for (;;) {
+    uint32_t s = latestSeq.load(std::memory_order_acquire);
+    if ((s & 1u) == 0) {
+      GasReadings copy = latestProcessed;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (latestSeq.load(std::memory_order_relaxed) == s) {
+        return copy;
+      }
+    }
+    // Writer mid-copy: its window is a 20-byte struct store, retry
+  }
+}
+
+SpscRing<GasReadings, TASKS_SNAPSHOT_RING_SIZE> &firmwareSnapshotRing() {
+  return snapshotRing;
+}
+
+AnomalyGate &firmwareAnomalyGate() {
+  return anomalyGate;
+}
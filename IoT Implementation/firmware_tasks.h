@@ -0,0 +1,62 @@
+/**
+ * GasGuard - Dual-Core Task Split
+ *
+ * Restructures the firmware from a single Arduino loop() into two
+ * pinned FreeRTOS tasks:
+ *
+ *   Core 0: sampling task  — high priority, produces GasReadings
+ *           snapshots at a fixed cadence and publishes them to a queue.
+ *           Never touches the network.
+ *
+ *   Core 1: processing task — consumes snapshots, handles diagnostics
+ *           and (once wired) transport to the backend. A slow or
+ *           retrying network send can never stall sampling.
+ *
+ * The Arduino loop() becomes idle once firmwareTasksBegin() runs.
+ */
+
+#ifndef GASGUARD_FIRMWARE_TASKS_H
+#define GASGUARD_FIRMWARE_TASKS_H
+
+#include <stdint.h>
+
+#include "gas_readings.h"
+#include "spsc_ring.h"
+#include "anomaly_gate.h"
+
+// Snapshot cadence is risk-driven: the sampling task asks the adaptive
+// controller (adaptive_sampler.h) for its period every cycle.
+
+// Task priorities (idle = 0). Sampling outranks everything else.
+#define TASKS_SAMPLING_PRIORITY   (configMAX_PRIORITIES - 2)
+#define TASKS_PROCESSING_PRIORITY 2
+
+// Snapshot ring depth: at 10 Hz this absorbs ~1.6 s of consumer stall
+// before overwrite-oldest kicks in (power of two, see spsc_ring.h)
+#define TASKS_SNAPSHOT_RING_SIZE 16
+
+/**
+ * Create and pin both tasks. Call once at the end of setup(), after the
+ * ADC sampler and scheduler are running.
+ */
+void firmwareTasksBegin();
+
+/**
+ * Latest snapshot seen by the processing task (for diagnostics/UI).
+ */
+GasReadings firmwareTasksLatest();
+
+/**
+ * The sampling->processing snapshot ring. Producer is the sampling
+ * task only; the processing task is the only consumer.
+ */
+SpscRing<GasReadings, TASKS_SNAPSHOT_RING_SIZE> &firmwareSnapshotRing();
+
+/**
+ * The processing task's uplink gate. Exposed so the deep-sleep duty
+ * cycler can carry its window across sleeps; restore before
+ * firmwareTasksBegin() starts the tasks.
+ */
+AnomalyGate &firmwareAnomalyGate();
+
+#endif // GASGUARD_FIRMWARE_TASKS_H
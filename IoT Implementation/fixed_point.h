@@ -0,0 +1,87 @@
+/**
+ * GasGuard - Q16.16 Fixed-Point Math for the Sensor Hot Path
+ *
+ * Integer replacement for the float voltage→Rs→ratio pipeline in
+ * sensor_ppm_converter.cpp. Q16.16 gives 1/65536 resolution, far below
+ * the ±10-20% accuracy of the MQ sensors themselves, while turning the
+ * per-sample float divide into a 64-bit integer divide the CPU does
+ * without libm/softfloat help.
+ *
+ * The Rs formula collapses to pure integers when computed from raw ADC
+ * counts instead of volts:
+ *
+ *   Rs = (Vref * RL / Vout) - RL  =  RL * (ADC_MAX - counts) / counts
+ *
+ * so the fixed-point path never needs the voltage at all.
+ *
+ * Enabled by GASGUARD_FIXED_POINT in sensor_ppm_converter.cpp.
+ */
+
+#ifndef GASGUARD_FIXED_POINT_H
+#define GASGUARD_FIXED_POINT_H
+
+#include <stdint.h>
+
+// Q16.16 value: 16 integer bits, 16 fractional bits
+typedef int32_t q16_t;
+
+#define Q16_ONE   ((q16_t)(1 << 16))
+#define Q16_SHIFT 16
+
+// Mirror the hardware constants in sensor_ppm_converter.cpp
+#define Q16_ADC_MAX_COUNTS 4095
+#define Q16_RL_KOHM        10       // RL_VALUE, integral in kΩ
+
+/**
+ * Float <-> Q16.16 conversion (boundary use only — the hot path should
+ * stay in q16_t end to end)
+ */
+constexpr q16_t q16FromFloat(float f) {
+  return (q16_t)(f * 65536.0f + (f >= 0 ? 0.5f : -0.5f));
+}
+
+constexpr float q16ToFloat(q16_t q) {
+  return q / 65536.0f;
+}
+
+constexpr q16_t q16FromInt(int32_t i) {
+  return (q16_t)(i << Q16_SHIFT);
+}
+
+/**
+ * Q16.16 multiply / divide via 64-bit intermediates
+ */
+static inline q16_t q16Mul(q16_t a, q16_t b) {
+  return (q16_t)(((int64_t)a * (int64_t)b) >> Q16_SHIFT);
+}
+
+static inline q16_t q16Div(q16_t a, q16_t b) {
+  if (b == 0) return 0;
+  return (q16_t)((((int64_t)a) << Q16_SHIFT) / b);
+}
+
+/**
+ * Sensor resistance Rs (Q16.16, kΩ) straight from averaged ADC counts.
+ *
+ * Rs = RL * (ADC_MAX - counts) / counts — all-integer, no float, no
+ * voltage intermediate. Returns -Q16_ONE for saturated/invalid counts,
+ * matching the -1.0 sentinel of the float calculateRs().
+ */
+static inline q16_t q16RsFromCounts(int32_t counts) {
+  if (counts <= 0 || counts >= Q16_ADC_MAX_COUNTS) {
+    return -Q16_ONE;
+  }
+
+  int64_t num = (int64_t)Q16_RL_KOHM * (Q16_ADC_MAX_COUNTS - counts);
+  return (q16_t)((num << Q16_SHIFT) / counts);
+}
+
+/**
+ * Rs/R0 ratio in Q16.16. r0 is the calibration resistance in Q16.16 kΩ.
+ */
+static inline q16_t q16Ratio(q16_t rs, q16_t r0) {
+  if (rs <= 0 || r0 <= 0) return 0;
+  return q16Div(rs, r0);
+}
+
+#endif // GASGUARD_FIXED_POINT_H
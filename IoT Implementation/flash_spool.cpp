@@ -0,0 +1,210 @@
+/**
+ * GasGuard - Wear-Leveled Flash Spool (implementation)
+ *
+ * The spooled blocks on flash always form one contiguous sequence
+ * window [seqLo, seqHi]; block seq lives at sector seq % sectorCount,
+ * so the window can never be wider than the partition. Appending past
+ * a full partition advances seqLo — the oldest hour of backlog is the
+ * right thing to sacrifice. The boot scan recovers the window by
+ * taking the highest valid sequence and walking backwards while each
+ * expected sector still holds its block; anything torn or stale fails
+ * CRC/magic and ends the walk.
+ */
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#include "flash_spool.h"
+#include "gg_crc32.h"
+#include "gg_log.h"
+
+static const esp_partition_t *spoolPartition = NULL;
+static uint32_t sectorCount = 0;
+
+// Live window on flash; meaningless while haveBlocks is false
+static bool haveBlocks = false;
+static uint32_t seqLo = 0;
+static uint32_t seqHi = 0;
+
+// One staged sector in RAM (header filled in at write time), plus a
+// separate read buffer so draining never clobbers staged records
+static uint8_t stage[SPOOL_BLOCK_SIZE];
+static uint8_t readBuf[SPOOL_BLOCK_SIZE];
+static size_t stageCount = 0;     // records staged so far
+static uint16_t recordSeq = 0;    // per-boot record counter
+
+static SpoolRecord *stageRecords() {
+  return (SpoolRecord *)(stage + sizeof(SpoolBlockHeader));
+}
+
+// ============================================================================
+// BLOCK I/O
+// ============================================================================
+
+/**
+ * Read and validate the block at `seq`; returns its record count into
+ * `buf` (a full SPOOL_BLOCK_SIZE buffer) or 0 if the block is missing
+ * or corrupt.
+ */
+static uint16_t readBlock(uint32_t seq, uint8_t *buf) {
+  uint32_t offset = (seq % sectorCount) * SPOOL_BLOCK_SIZE;
+  if (esp_partition_read(spoolPartition, offset, buf, SPOOL_BLOCK_SIZE) !=
+      ESP_OK) {
+    return 0;
+  }
+
+  const SpoolBlockHeader *h = (const SpoolBlockHeader *)buf;
+  if (h->magic != SPOOL_BLOCK_MAGIC || h->blockSeq != seq ||
+      h->count == 0 || h->count > SPOOL_RECORDS_PER_BLOCK) {
+    return 0;
+  }
+  uint32_t crc = ggCrc32(buf + sizeof(SpoolBlockHeader),
+                         h->count * sizeof(SpoolRecord));
+  return crc == h->crc32 ? h->count : 0;
+}
+
+/** Seal the staging buffer as block `seq` and write it out. */
+static bool writeStagedBlock(uint32_t seq) {
+  SpoolBlockHeader *h = (SpoolBlockHeader *)stage;
+  h->magic = SPOOL_BLOCK_MAGIC;
+  h->blockSeq = seq;
+  h->count = (uint16_t)stageCount;
+  h->reserved = 0;
+  h->crc32 = ggCrc32(stage + sizeof(SpoolBlockHeader),
+                     stageCount * sizeof(SpoolRecord));
+
+  uint32_t offset = (seq % sectorCount) * SPOOL_BLOCK_SIZE;
+  size_t used = sizeof(SpoolBlockHeader) + stageCount * sizeof(SpoolRecord);
+  if (esp_partition_erase_range(spoolPartition, offset, SPOOL_BLOCK_SIZE) !=
+          ESP_OK ||
+      esp_partition_write(spoolPartition, offset, stage, used) != ESP_OK) {
+    return false;
+  }
+  return true;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void flashSpoolBegin() {
+  spoolPartition = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "spool");
+  if (spoolPartition == NULL) {
+    Serial.println("⚠️  Flash spool: no 'spool' partition — offline "
+                   "buffering disabled");
+    return;
+  }
+  sectorCount = spoolPartition->size / SPOOL_BLOCK_SIZE;
+  haveBlocks = false;
+
+  // Recover the window: highest valid sequence, then walk backwards
+  // while each expected sector still holds its block
+  uint32_t best = 0;
+  bool found = false;
+  for (uint32_t s = 0; s < sectorCount; s++) {
+    SpoolBlockHeader h;
+    if (esp_partition_read(spoolPartition, s * SPOOL_BLOCK_SIZE, &h,
+                           sizeof(h)) != ESP_OK) {
+      continue;
+    }
+    if (h.magic == SPOOL_BLOCK_MAGIC && (h.blockSeq % sectorCount) == s &&
+        readBlock(h.blockSeq, readBuf) > 0 && (!found || h.blockSeq > best)) {
+      best = h.blockSeq;
+      found = true;
+    }
+  }
+
+  if (found) {
+    haveBlocks = true;
+    seqHi = best;
+    seqLo = best;
+    while (seqLo > 0 && seqHi - (seqLo - 1) < sectorCount &&
+           readBlock(seqLo - 1, readBuf) > 0) {
+      seqLo--;
+    }
+    Serial.printf("💾 Flash spool: %u sector(s), %u block(s) of backlog "
+                  "recovered\n", sectorCount, seqHi - seqLo + 1);
+  } else {
+    Serial.printf("💾 Flash spool: %u sector(s), empty\n", sectorCount);
+  }
+  stageCount = 0;
+}
+
+bool flashSpoolAppend(const GasReadings &readings, uint8_t risk) {
+  if (spoolPartition == NULL) return false;
+
+  SpoolRecord *r = stageRecords() + stageCount;
+  r->ms = millis();
+  r->ppm[0] = (int32_t)(readings.methane * 100.0f);
+  r->ppm[1] = (int32_t)(readings.lpg * 100.0f);
+  r->ppm[2] = (int32_t)(readings.carbonMonoxide * 100.0f);
+  r->ppm[3] = (int32_t)(readings.hydrogenSulfide * 100.0f);
+  r->seq = recordSeq++;
+  r->risk = risk;
+  r->flags = readings.valid ? 0x01 : 0x00;
+  stageCount++;
+
+  if (stageCount < SPOOL_RECORDS_PER_BLOCK) return true;
+  return flashSpoolFlush();
+}
+
+bool flashSpoolFlush() {
+  if (spoolPartition == NULL || stageCount == 0) return false;
+
+  uint32_t seq = haveBlocks ? seqHi + 1 : 0;
+  // Partition full: the new block's sector holds the oldest block, so
+  // writing it drops that block from the window
+  if (haveBlocks && seqHi - seqLo + 1 == sectorCount) {
+    seqLo++;
+  }
+
+  if (!writeStagedBlock(seq)) {
+    GGLOG(GGLOG_SPOOL_WRITE_FAIL, 0, (int32_t)seq, 0);
+    Serial.println("❌ Flash spool: sector write failed, block dropped");
+    stageCount = 0;
+    return false;
+  }
+
+  haveBlocks = true;
+  seqHi = seq;
+  stageCount = 0;
+  return true;
+}
+
+size_t flashSpoolReadBlock(SpoolRecord *out, bool newestFirst,
+                           uint32_t *blockSeq) {
+  if (spoolPartition == NULL || !haveBlocks) return 0;
+
+  uint32_t seq = newestFirst ? seqHi : seqLo;
+  uint16_t n = readBlock(seq, readBuf);
+  if (n == 0) {
+    // Corrupt in place (should not happen past the boot scan): drop it
+    // so the drain does not spin on the same block forever
+    flashSpoolConsume(seq);
+    return 0;
+  }
+  memcpy(out, readBuf + sizeof(SpoolBlockHeader), n * sizeof(SpoolRecord));
+  *blockSeq = seq;
+  return n;
+}
+
+void flashSpoolConsume(uint32_t blockSeq) {
+  if (spoolPartition == NULL || !haveBlocks) return;
+  if (blockSeq != seqLo && blockSeq != seqHi) return;  // middle never read
+
+  esp_partition_erase_range(spoolPartition,
+                            (blockSeq % sectorCount) * SPOOL_BLOCK_SIZE,
+                            SPOOL_BLOCK_SIZE);
+  if (seqLo == seqHi) {
+    haveBlocks = false;
+  } else if (blockSeq == seqLo) {
+    seqLo++;
+  } else {
+    seqHi--;
+  }
+}
+
+size_t flashSpoolBacklog() {
+  return haveBlocks ? seqHi - seqLo + 1 : 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * GasGuard - Wear-Leveled Flash Spool
+ *
+ * Append-only time-series log on a dedicated flash data partition so
+ * readings survive Wi-Fi outages instead of being dropped. Records are
+ * fixed-size binary (24 B) and are staged in one RAM sector; a sector
+ * is erased and written only when the staging buffer fills (or on an
+ * explicit flush), so write amplification stays near 1 and a record
+ * append is just a memcpy — cheap enough for the processing task,
+ * never run on the sampling task.
+ *
+ * Layout: the partition is an array of 4 KB blocks, each
+ *
+ *     SpoolBlockHeader (16 B) + up to SPOOL_RECORDS_PER_BLOCK records
+ *
+ * with a CRC32 (gg_crc32.h) over the records. Blocks carry a
+ * monotonically increasing sequence number and land at
+ * blockSeq % sectorCount, which spreads erases evenly across the
+ * partition — at one block per outage-hour, a 64 KB partition outlives
+ * the sensors. A torn write fails its CRC at boot scan and is simply
+ * skipped.
+ *
+ * Draining is split into read + consume so a block is only erased
+ * after its publish succeeded. Readers pick the end: newest-first for
+ * live relevance right after reconnect, oldest-first for backfill.
+ */
+
+#ifndef GASGUARD_FLASH_SPOOL_H
+#define GASGUARD_FLASH_SPOOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "gas_readings.h"
+
+#define SPOOL_BLOCK_SIZE   4096           // one flash sector
+#define SPOOL_BLOCK_MAGIC  0x47474231u    // "GGB1"
+
+// 24 bytes, matches the uplink's centi-PPM fixed-point convention
+struct SpoolRecord {
+  uint32_t ms;          // millis() at capture
+  int32_t ppm[4];       // centi-PPM, channel order SCHED_CH_*
+  uint16_t seq;         // per-boot record counter (gap detection)
+  uint8_t risk;         // RiskState at capture
+  uint8_t flags;        // bit0: readings were valid
+};
+
+struct SpoolBlockHeader {
+  uint32_t magic;       // SPOOL_BLOCK_MAGIC
+  uint32_t blockSeq;    // monotonic; position = blockSeq % sectorCount
+  uint16_t count;       // records in this block
+  uint16_t reserved;
+  uint32_t crc32;       // over count * sizeof(SpoolRecord) bytes
+};
+
+#define SPOOL_RECORDS_PER_BLOCK \
+  ((SPOOL_BLOCK_SIZE - sizeof(SpoolBlockHeader)) / sizeof(SpoolRecord))
+
+/**
+ * Find the "spool" data partition and scan block headers to recover
+ * the live sequence range from a previous boot. Degrades to a no-op
+ * spool (append/flush return false) if the partition table has no
+ * spool entry, so the rest of the firmware does not care.
+ */
+void flashSpoolBegin();
+
+/**
+ * Stage one record. Erases+writes a sector only when the staging
+ * buffer fills (~170 records). Returns false if the spool is absent
+ * or the flash write failed.
+ */
+bool flashSpoolAppend(const GasReadings &readings, uint8_t risk);
+
+/**
+ * Force the partial staging buffer out to flash (e.g. before deep
+ * sleep). A subsequent append starts a fresh block.
+ */
+bool flashSpoolFlush();
+
+/**
+ * Copy the records of one spooled block into `out` (capacity
+ * SPOOL_RECORDS_PER_BLOCK) without consuming it; newestFirst selects
+ * which end of the backlog. Returns the record count, 0 when empty.
+ * *blockSeq identifies the block for flashSpoolConsume().
+ */
+size_t flashSpoolReadBlock(SpoolRecord *out, bool newestFirst,
+                           uint32_t *blockSeq);
+
+/**
+ * Erase a block previously returned by flashSpoolReadBlock() — call
+ * only after its contents were published successfully.
+ */
+void flashSpoolConsume(uint32_t blockSeq);
+
+/** Blocks currently spooled on flash (excludes the staging buffer). */
+size_t flashSpoolBacklog();
+
+#endif // GASGUARD_FLASH_SPOOL_H
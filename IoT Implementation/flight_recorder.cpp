@@ -0,0 +1,94 @@
+/**
+ * GasGuard - Burst-Capture Flight Recorder (implementation)
+ *
+ * A dedicated task ticks at FLIGHT_RATE_HZ and copies the latest raw
+ * sample of each channel out of the DMA ring buffers. The arena is one
+ * static array — no allocation after boot, ever.
+ */
+
+#include <Arduino.h>
+
+#include "flight_recorder.h"
+#include "adc_sampler.h"
+
+// The arena: ~36 KB, statically allocated
+static FlightSample arena[FLIGHT_RING_ENTRIES];
+static volatile uint32_t writeIndex = 0;      // monotonic
+static volatile bool frozen = false;
+
+static int capturePins[4];
+static size_t captureNumPins = 0;
+static TaskHandle_t captureTaskHandle = NULL;
+
+/**
+ * Capture tick: one timestamp + four 16-bit stores. Runs above the
+ * processing task so transport work cannot starve the recorder.
+ */
+static void flightCaptureTask(void *arg) {
+  TickType_t lastWake = xTaskGetTickCount();
+  const TickType_t period = pdMS_TO_TICKS(1000 / FLIGHT_RATE_HZ);
+
+  for (;;) {
+    if (!frozen) {
+      FlightSample &slot = arena[writeIndex % FLIGHT_RING_ENTRIES];
+      slot.ms = millis();
+      for (size_t ch = 0; ch < captureNumPins; ch++) {
+        // Latest raw sample (window of 1) — unfiltered on purpose:
+        // post-incident analysis wants the glitches too
+        float raw = adcSamplerWindowAvg(capturePins[ch], 1);
+        slot.counts[ch] = raw < 0 ? 0xFFFF : (uint16_t)raw;
+      }
+      writeIndex = writeIndex + 1;
+    }
+
+    vTaskDelayUntil(&lastWake, period);
+  }
+}
+
+void flightRecorderBegin(const int *pins, size_t numPins) {
+  if (captureTaskHandle != NULL) return;
+
+  if (numPins > 4) numPins = 4;
+  for (size_t i = 0; i < numPins; i++) capturePins[i] = pins[i];
+  captureNumPins = numPins;
+
+  xTaskCreatePinnedToCore(flightCaptureTask, "gg_flight", 2048, NULL,
+                          3, &captureTaskHandle, 0);
+
+  Serial.printf("✅ Flight recorder: %d Hz, %d s pre-trigger (%u KB)\n",
+                FLIGHT_RATE_HZ, FLIGHT_PRETRIGGER_SEC,
+                (unsigned)(sizeof(arena) / 1024));
+}
+
+void flightRecorderFreeze() {
+  frozen = true;
+}
+
+void flightRecorderResume() {
+  frozen = false;
+}
+
+bool flightRecorderFrozen() {
+  return frozen;
+}
+
+size_t flightRecorderCount() {
+  uint32_t wr = writeIndex;
+  return wr < FLIGHT_RING_ENTRIES ? wr : FLIGHT_RING_ENTRIES;
+}
+
+size_t flightRecorderRead(size_t offset, FlightSample *out, size_t maxOut) {
+  if (!frozen) return 0;
+
+  uint32_t wr = writeIndex;
+  size_t held = wr < FLIGHT_RING_ENTRIES ? wr : FLIGHT_RING_ENTRIES;
+  if (offset >= held) return 0;
+
+  // Oldest entry is at wr - held; walk forward from there
+  size_t n = 0;
+  while (n < maxOut && (offset + n) < held) {
+    out[n] = arena[(wr - held + offset + n) % FLIGHT_RING_ENTRIES];
+    n++;
+  }
+  return n;
+}
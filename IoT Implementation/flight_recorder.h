@@ -0,0 +1,68 @@
+/**
+ * GasGuard - Burst-Capture Flight Recorder
+ *
+ * Continuously records raw ADC counts (not converted PPM — 12 bytes
+ * per entry) for all four channels at FLIGHT_RATE_HZ into a circular
+ * RAM arena allocated once at boot. When the on-device classifier
+ * crosses ALERT, the ring is frozen, preserving the
+ * FLIGHT_PRETRIGGER_SEC seconds of history *before* the spike — the
+ * data every incident investigation asks for first.
+ *
+ * The capture path is a timestamp plus four 16-bit stores per tick
+ * (effectively a memcpy), cheap enough to run at hundreds of Hz
+ * alongside normal operation.
+ */
+
+#ifndef GASGUARD_FLIGHT_RECORDER_H
+#define GASGUARD_FLIGHT_RECORDER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Capture rate and pre-trigger depth. 100 Hz x 30 s x 12 B = ~36 KB of
+// RAM, allocated statically at boot.
+#define FLIGHT_RATE_HZ        100
+#define FLIGHT_PRETRIGGER_SEC 30
+#define FLIGHT_RING_ENTRIES   (FLIGHT_RATE_HZ * FLIGHT_PRETRIGGER_SEC)
+
+struct FlightSample {
+  uint32_t ms;          // millis() at capture
+  uint16_t counts[4];   // raw ADC, channel order SCHED_CH_*
+};
+
+/**
+ * Allocate nothing, start the capture task. Call once from setup()
+ * after adcSamplerBegin(); the arena is a static array.
+ */
+void flightRecorderBegin(const int *pins, size_t numPins);
+
+/**
+ * Freeze the ring (idempotent until resumed). Call when the classifier
+ * crosses ALERT; capture stops so the pre-trigger history survives.
+ */
+void flightRecorderFreeze();
+
+/**
+ * Resume capture after the frozen history has been retrieved.
+ */
+void flightRecorderResume();
+
+/**
+ * True while frozen.
+ */
+bool flightRecorderFrozen();
+
+/**
+ * Access the frozen history, oldest first. Returns the number of valid
+ * entries copied into `out` (up to maxOut), 0 if not frozen. Intended
+ * for chunked upload by the transport task.
+ */
+size_t flightRecorderRead(size_t offset, FlightSample *out, size_t maxOut);
+
+/**
+ * Entries currently held (ring fills to FLIGHT_RING_ENTRIES and stays
+ * there).
+ */
+size_t flightRecorderCount();
+
+#endif // GASGUARD_FLIGHT_RECORDER_H
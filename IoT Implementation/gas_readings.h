@@ -0,0 +1,26 @@
+/**
+ * GasGuard - Shared GasReadings Snapshot Type
+ *
+ * One complete 4-gas snapshot, as produced by readAllSensors(). Moved
+ * out of sensor_ppm_converter.cpp so the sampling/processing tasks and
+ * transport layers can share it without including the whole sketch.
+ */
+
+#ifndef GASGUARD_GAS_READINGS_H
+#define GASGUARD_GAS_READINGS_H
+
+struct GasReadings {
+  float methane;           // MQ-4, PPM
+  float lpg;               // MQ-6, PPM
+  float carbonMonoxide;    // MQ-7, PPM
+  float hydrogenSulfide;   // MQ-136, PPM
+  bool valid;
+};
+
+/**
+ * Implemented in sensor_ppm_converter.cpp: one coherent snapshot of all
+ * four sensors from the current sampling window.
+ */
+GasReadings readAllSensors();
+
+#endif // GASGUARD_GAS_READINGS_H
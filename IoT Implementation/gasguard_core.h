@@ -0,0 +1,44 @@
+/**
+ * GasGuard - Platform-Free Core Library
+ *
+ * One include for everything in the pipeline that does NOT touch
+ * hardware: conversion, filtering, classification, gating, encoding,
+ * buffering and the adaptive-rate controller. Every header listed here
+ * obeys the core contract:
+ *
+ *   - no <Arduino.h>, no ESP-IDF, no Serial — standard C++ only
+ *   - no hidden clock: anything time-dependent takes nowMs as a
+ *     parameter (AnomalyGate::update, adaptiveSamplerUpdate)
+ *   - side effects leave through injected hooks or returned data,
+ *     never through a global device call (AdaptiveProfileHook,
+ *     MqttDownlinkHandler-style function pointers)
+ *
+ * That contract is what lets the same translation units run in three
+ * places: the firmware, the micro-benchmark (bench/) and the
+ * deterministic simulation harness (sim/), which pushes millions of
+ * Datasets-derived samples per second through this exact code on a
+ * desktop. Tuning a threshold or a filter weight is a host rebuild
+ * measured in seconds, not a flash-and-watch-serial cycle.
+ *
+ * Keep it that way: a new include here must compile with plain g++
+ * (the sim/ Makefile is the gate), and hardware-facing modules
+ * (adc_sampler, mqtt_uplink, flash_spool, ...) stay out — they are
+ * the injection points, not the core.
+ */
+
+#ifndef GASGUARD_CORE_H
+#define GASGUARD_CORE_H
+
+#include "gas_readings.h"      // the shared snapshot type
+#include "fixed_point.h"       // Q16.16 Rs-from-counts
+#include "ppm_lut.h"           // log2-domain Rs/R0 -> PPM lookup
+#include "batch_convert.h"     // branchless SoA conversion kernel
+#include "stream_filter.h"     // per-channel EWMA + outlier rejection
+#include "risk_classifier.h"   // threshold table -> RiskState
+#include "adaptive_sampler.h"  // closed-loop sampling cadence
+#include "anomaly_gate.h"      // NORMAL-traffic suppression
+#include "uplink_codec.h"      // batched binary frame encoder
+#include "spsc_ring.h"         // lock-free task hand-off
+#include "gg_crc32.h"          // shared CRC32 (OTA, flash spool)
+
+#endif // GASGUARD_CORE_H
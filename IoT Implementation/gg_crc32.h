@@ -0,0 +1,31 @@
+/**
+ * GasGuard - CRC32 (poly 0xEDB88320)
+ *
+ * Shared by the OTA delta applier and the flash spool; matches
+ * zlib/binascii on the host-tool side. Bitwise on purpose: both users
+ * run it on cold paths (patch application, sector flush) where the
+ * 1 KB table isn't worth its RAM.
+ */
+
+#ifndef GASGUARD_GG_CRC32_H
+#define GASGUARD_GG_CRC32_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+inline uint32_t ggCrc32Update(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int b = 0; b < 8; b++) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+inline uint32_t ggCrc32(const uint8_t *data, size_t len) {
+  return ggCrc32Update(0, data, len);
+}
+
+#endif // GASGUARD_GG_CRC32_H
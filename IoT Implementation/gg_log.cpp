@@ -0,0 +1,67 @@
+/**
+ * GasGuard - Deferred Binary Log Channel (implementation)
+ *
+ * Entirely compiled out unless GGLOG_ENABLED=1.
+ */
+
+#include "gg_log.h"
+
+#if GGLOG_ENABLED
+
+#include <Arduino.h>
+
+#include "spsc_ring.h"
+
+// ~4 KB of RAM; at 10 Hz escalated sampling this absorbs several
+// seconds of drain-task stall before overwrite-oldest kicks in
+#define GGLOG_RING_SIZE 256
+
+// Batch sync marker so the host decoder can resynchronize mid-stream
+static const uint8_t GGLOG_SYNC[4] = { 0xA5, 0x5A, 'G', 'L' };
+
+static SpscRing<GgLogRecord, GGLOG_RING_SIZE> logRing;
+
+// Both the sampling and processing tasks log; a sub-microsecond
+// critical section around publish keeps the ring's producer side
+// effectively single (the consumer drain task needs nothing)
+static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * Low-priority drain: batches pending records and writes them raw to
+ * Serial. Runs below everything else, so logging can never delay
+ * sampling, classification, or transport.
+ */
+static void ggLogDrainTask(void *arg) {
+  GgLogRecord record;
+  GgLogRecord batch[32];
+
+  for (;;) {
+    size_t n = 0;
+    while (n < 32 && logRing.consume(record)) {
+      batch[n++] = record;
+    }
+
+    if (n > 0) {
+      Serial.write(GGLOG_SYNC, sizeof(GGLOG_SYNC));
+      uint8_t count = (uint8_t)n;
+      Serial.write(&count, 1);
+      Serial.write((const uint8_t *)batch, n * sizeof(GgLogRecord));
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(250));
+  }
+}
+
+void ggLogBegin() {
+  xTaskCreate(ggLogDrainTask, "gg_log", 2048, NULL, 1, NULL);
+}
+
+void ggLogWrite(uint16_t code, uint16_t arg0, int32_t arg1, int32_t arg2) {
+  GgLogRecord record = { millis(), code, arg0, arg1, arg2 };
+
+  portENTER_CRITICAL(&logMux);
+  logRing.publish(record);
+  portEXIT_CRITICAL(&logMux);
+}
+
+#endif // GGLOG_ENABLED
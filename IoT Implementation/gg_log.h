@@ -0,0 +1,74 @@
+/**
+ * GasGuard - Deferred Binary Log Channel
+ *
+ * Hot-path logging that costs nothing in release builds and never
+ * formats a float on-device. In instrumented builds (GGLOG_ENABLED=1)
+ * each GGLOG() call writes one fixed 16-byte record into a lock-free
+ * RAM ring; a low-priority drain task streams raw records out over
+ * Serial in batches. Decoding to human-readable text happens off-device
+ * (any host script that knows the record layout).
+ *
+ * Values travel as integers — PPM and Rs as centi-units, voltages as
+ * millivolts — so the hot path does an integer store instead of a
+ * printf("%.2f") at 115200 baud.
+ *
+ * One-time boot/status messages stay on plain Serial; GGLOG is for
+ * anything emitted per reading.
+ */
+
+#ifndef GASGUARD_GG_LOG_H
+#define GASGUARD_GG_LOG_H
+
+#include <stdint.h>
+
+// 0 = release: every GGLOG() compiles to nothing
+// 1 = instrumented: binary records into the RAM ring, drained async
+#ifndef GGLOG_ENABLED
+#define GGLOG_ENABLED 0
+#endif
+
+// Record codes (decoder contract — append only, never renumber)
+enum GgLogCode : uint16_t {
+  GGLOG_SENSOR_READ     = 1,  // arg0=pin, arg1=Rs centi-kΩ, arg2=centi-PPM
+  GGLOG_INVALID_READING = 2,  // arg0=pin
+  GGLOG_SNAPSHOT        = 3,  // arg1=centi-PPM CH4, arg2=centi-PPM LPG
+  GGLOG_SNAPSHOT2       = 4,  // arg1=centi-PPM CO,  arg2=centi-PPM H2S
+  GGLOG_RISK_STATE      = 5,  // arg0=RiskState
+  GGLOG_UPLINK_FRAME    = 6,  // arg0=snapshots, arg1=bytes
+  GGLOG_STAGE_OVERRUN   = 7,  // arg0=PipelineStage, arg1=us, arg2=deadline us
+  GGLOG_SPOOL_WRITE_FAIL = 8, // arg1=blockSeq
+};
+
+// Fixed 16-byte record; layout shared with the host decoder
+struct GgLogRecord {
+  uint32_t ms;     // millis() at write time
+  uint16_t code;   // GgLogCode
+  uint16_t arg0;
+  int32_t arg1;
+  int32_t arg2;
+};
+
+#if GGLOG_ENABLED
+
+/**
+ * Start the drain task. Call once from setup().
+ */
+void ggLogBegin();
+
+/**
+ * Append one record. Lock-free, never blocks; overwrites oldest if the
+ * drain task falls behind.
+ */
+void ggLogWrite(uint16_t code, uint16_t arg0, int32_t arg1, int32_t arg2);
+
+#define GGLOG_BEGIN()                ggLogBegin()
+#define GGLOG(code, arg0, a1, a2)    ggLogWrite((code), (arg0), (a1), (a2))
+
+#else
+
+#define GGLOG_BEGIN()                ((void)0)
+#define GGLOG(code, arg0, a1, a2)    ((void)0)
+
+#endif // GGLOG_ENABLED
+
+#endif // GASGUARD_GG_LOG_H
@@ -0,0 +1,86 @@
+/**
+ * GasGuard - MQ-7 Heater-Cycle Scheduler (implementation)
+ *
+ * A low-priority task ticks once a second and drives the two-phase
+ * state machine via LEDC PWM. During the measurement window it keeps
+ * re-latching the filtered sensor voltage, so the latched value is
+ * always from the freshest valid stretch of the cycle.
+ */
+
+#include <Arduino.h>
+
+#include "mq7_heater.h"
+#include "adc_sampler.h"
+
+#define MQ7_PWM_CHANNEL 4
+
+enum Mq7Phase { MQ7_PHASE_HIGH, MQ7_PHASE_LOW };
+
+static int mq7SensorPin = -1;
+static Mq7Phase phase = MQ7_PHASE_HIGH;
+static uint32_t phaseStartMs = 0;
+static volatile float latchedVoltage = -1.0f;
+static volatile bool inWindow = false;
+
+static void setHeater(uint32_t duty) {
+  ledcWrite(MQ7_PWM_CHANNEL, duty);
+}
+
+static void mq7HeaterTask(void *arg) {
+  phaseStartMs = millis();
+  setHeater(255);   // Start in burn-off
+
+  for (;;) {
+    uint32_t elapsed = millis() - phaseStartMs;
+
+    if (phase == MQ7_PHASE_HIGH) {
+      inWindow = false;
+      if (elapsed >= MQ7_PHASE_HIGH_MS) {
+        phase = MQ7_PHASE_LOW;
+        phaseStartMs = millis();
+        setHeater(MQ7_LOW_DUTY);
+      }
+    } else {
+      // Valid window: final MQ7_MEASURE_WINDOW_MS of the low phase
+      bool windowNow = elapsed >= (MQ7_PHASE_LOW_MS - MQ7_MEASURE_WINDOW_MS);
+      inWindow = windowNow;
+
+      if (windowNow) {
+        float v = adcSamplerFilteredVoltage(mq7SensorPin);
+        if (v >= 0) {
+          latchedVoltage = v;   // keep re-latching: freshest valid value
+        }
+      }
+
+      if (elapsed >= MQ7_PHASE_LOW_MS) {
+        phase = MQ7_PHASE_HIGH;
+        phaseStartMs = millis();
+        setHeater(255);
+      }
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(1000));
+  }
+}
+
+void mq7HeaterBegin(int sensorPin) {
+  if (mq7SensorPin >= 0) return;  // Already running
+  mq7SensorPin = sensorPin;
+
+  ledcSetup(MQ7_PWM_CHANNEL, MQ7_HEATER_PWM_FREQ, MQ7_HEATER_PWM_BITS);
+  ledcAttachPin(MQ7_HEATER_PIN, MQ7_PWM_CHANNEL);
+
+  xTaskCreate(mq7HeaterTask, "gg_mq7", 2048, NULL, 1, NULL);
+
+  Serial.printf("✅ MQ-7 heater cycle: %ds high / %ds low, %ds window\n",
+                MQ7_PHASE_HIGH_MS / 1000, MQ7_PHASE_LOW_MS / 1000,
+                MQ7_MEASURE_WINDOW_MS / 1000);
+}
+
+float mq7PhaseAlignedVoltage() {
+  return latchedVoltage;
+}
+
+bool mq7InMeasurementWindow() {
+  return inWindow;
+}
@@ -0,0 +1,58 @@
+/**
+ * GasGuard - MQ-7 Heater-Cycle Scheduler
+ *
+ * The MQ-7 CO sensor is only valid when sampled in the right heater
+ * phase: the datasheet cycle is 60 s at 5.0 V (burn-off) followed by
+ * 90 s at 1.4 V (measurement), with the reading taken near the end of
+ * the low phase. readCO_PPM() used to ignore this and read whenever
+ * called, averaging garbage from the wrong phase.
+ *
+ * This driver runs the heater from a PWM pin (through the usual MOSFET
+ * stage) with a timer-driven state machine, and during the valid tail
+ * of each low phase latches the freshest filtered MQ-7 voltage. The
+ * snapshot path then substitutes the latched phase-valid voltage for
+ * the live one, so every published CO value comes from a correct
+ * measurement window — at the maximum rate the sensor physically
+ * supports (one fresh value per 150 s cycle, held between windows).
+ */
+
+#ifndef GASGUARD_MQ7_HEATER_H
+#define GASGUARD_MQ7_HEATER_H
+
+#include <stdint.h>
+
+// Heater control pin (gate of the heater MOSFET) and PWM setup
+#define MQ7_HEATER_PIN        26
+#define MQ7_HEATER_PWM_FREQ   1000
+#define MQ7_HEATER_PWM_BITS   8
+
+// Datasheet cycle: 60 s high (5.0 V), 90 s low (1.4 V)
+#define MQ7_PHASE_HIGH_MS     60000
+#define MQ7_PHASE_LOW_MS      90000
+
+// Duty for the 1.4 V measurement phase from a 5 V heater rail
+#define MQ7_LOW_DUTY          ((uint32_t)(255 * 1.4 / 5.0))
+
+// Valid measurement window: the final stretch of the low phase, after
+// the element has settled at measurement temperature
+#define MQ7_MEASURE_WINDOW_MS 20000
+
+/**
+ * Start the heater cycle. Call from setup() after adcSamplerBegin();
+ * `sensorPin` is the MQ-7 ADC pin the latched voltage is read from.
+ */
+void mq7HeaterBegin(int sensorPin);
+
+/**
+ * Freshest phase-valid MQ-7 voltage, latched during the most recent
+ * measurement window. Returns -1.0 until the first window completes
+ * (callers fall back to the live voltage).
+ */
+float mq7PhaseAlignedVoltage();
+
+/**
+ * True while the cycle is inside the valid measurement window.
+ */
+bool mq7InMeasurementWindow();
+
+#endif // GASGUARD_MQ7_HEATER_H
@@ -0,0 +1,112 @@
+/**
+ * GasGuard - Generic MQ Sensor Template
+ *
+ * One implementation of the voltage→Rs→PPM read path, specialized per
+ * sensor through a traits struct carrying the pin, calibration R0 and
+ * datasheet A/B constants. The four hand-written readXxxPPM() copies in
+ * sensor_ppm_converter.cpp collapse to one-line wrappers around this.
+ *
+ * Because every per-sensor constant is a compile-time trait, the
+ * compiler constant-folds the math and inlines the whole path per
+ * specialization — no duplicated function bodies, no constants loaded
+ * from memory, and the per-sensor PPM lookup table is materialized once
+ * per specialization at compile time.
+ *
+ * Per-read diagnostics go through the deferred binary log channel
+ * (gg_log.h); nothing on this path formats a float or touches Serial.
+ *
+ * Traits contract:
+ *   static constexpr int    PIN;     // ADC GPIO
+ *   static constexpr int    CHANNEL; // SCHED_CH_* / calibration index
+ *   static constexpr float  R0;      // default clean-air resistance, kΩ
+ *   static constexpr double A, B;    // PPM = A * (Rs/R0)^B
+ *   static constexpr const char *NAME;  // e.g. "MQ-4 (CH4)"
+ *
+ * R0 at runtime comes from the persistent calibration store; the R0
+ * trait is only the fallback default registered at boot.
+ */
+
+#ifndef GASGUARD_MQ_SENSOR_H
+#define GASGUARD_MQ_SENSOR_H
+
+#include "ppm_lut.h"
+#include "gg_log.h"
+#include "calibration_store.h"
+#include "env_compensation.h"
+#include "fixed_point.h"
+
+// Hot-path arithmetic selector; the sketch defines it (before its
+// includes) in sensor_ppm_converter.cpp, default to float elsewhere
+#ifndef GASGUARD_FIXED_POINT
+#define GASGUARD_FIXED_POINT 0
+#endif
+
+// Hardware constants, mirroring sensor_ppm_converter.cpp
+#define MQSENSOR_V_REF    3.3f
+#define MQSENSOR_RL_KOHM  10.0f
+
+template <typename Traits>
+class MQSensor {
+ public:
+  /**
+   * Convert a voltage snapshot to gas concentration in PPM.
+   * Same contract as the old readXxxPPM() functions: 0.0 on invalid
+   * readings, never negative.
+   */
+  static float readPPM(float voltage) {
+    float Rs = calculateRs(voltage);
+
+    if (Rs < 0) {
+      // Deferred binary record — compiles to nothing in release builds
+      GGLOG(GGLOG_INVALID_READING, Traits::PIN, 0, 0);
+      return 0.0f;
+    }
+
+    // Reference Rs back to datasheet conditions for the current
+    // ambient temperature/humidity (two lerps, see env_compensation.h)
+    Rs = envCompensateRs(Traits::CHANNEL, Rs);
+
+    // Per-device R0 from the calibration store (O(1) cache read);
+    // falls back to the Traits::R0 default on uncalibrated nodes
+    float ppm = ppmLutLookup(lut(), Rs / calibrationR0(Traits::CHANNEL));
+
+    GGLOG(GGLOG_SENSOR_READ, Traits::PIN,
+          (int32_t)(Rs * 100.0f), (int32_t)(ppm * 100.0f));
+
+    return ppm;
+  }
+
+  /**
+   * Sensor resistance from voltage: Rs = [(Vc * RL) / Vout] - RL
+   *
+   * With GASGUARD_FIXED_POINT the divide runs in the Q16.16 integer
+   * pipeline on reconstructed ADC counts (see fixed_point.h) — same
+   * sentinel contract, float only at the boundaries.
+   */
+  static float calculateRs(float voltage) {
+#if GASGUARD_FIXED_POINT
+    int32_t counts =
+        (int32_t)(voltage * (Q16_ADC_MAX_COUNTS / MQSENSOR_V_REF) + 0.5f);
+    q16_t rs = q16RsFromCounts(counts);
+    if (rs < 0) {
+      return -1.0f;
+    }
+    return q16ToFloat(rs);
+#else
+    if (voltage <= 0.0f || voltage >= MQSENSOR_V_REF) {
+      return -1.0f;
+    }
+    return ((MQSENSOR_V_REF * MQSENSOR_RL_KOHM) / voltage) - MQSENSOR_RL_KOHM;
+#endif
+  }
+
+  /**
+   * This specialization's compile-time conversion table
+   */
+  static const PpmLut &lut() {
+    static constexpr PpmLut table = ppmLutBuild(Traits::A, Traits::B);
+    return table;
+  }
+};
+
+#endif // GASGUARD_MQ_SENSOR_H
@@ -0,0 +1,269 @@
+/**
+ * GasGuard - Persistent MQTT Uplink (implementation)
+ *
+ * Uses the esp-mqtt client bundled with arduino-esp32. All buffers are
+ * static; the only allocation is the client handle itself, created
+ * once in mqttUplinkBegin() before the steady state starts.
+ */
+
+#include <Arduino.h>
+#include <mqtt_client.h>
+#include <string.h>
+
+#include "mqtt_uplink.h"
+#include "uplink_codec.h"
+
+static esp_mqtt_client_handle_t mqttClient = NULL;
+static volatile bool connected = false;
+
+// Prebuilt once in mqttUplinkBegin(); never rebuilt per message
+static char readingsTopic[64];
+static char clientIdCopy[32];
+
+// Downlink routing (OTA patches, ventilation commands arrive here)
+struct DownlinkSlot {
+  char suffix[16];
+  char topic[64];
+  MqttDownlinkHandler handler;
+};
+static DownlinkSlot downlinks[MQTT_DOWNLINK_SLOTS];
+static uint8_t downlinkCount = 0;
+static char lastSuffix[16];   // continuation fragments carry no topic
+
+// ============================================================================
+// PENDING FRAME RING (static slots, overwrite-oldest)
+// ============================================================================
+
+struct PendingFrame {
+  uint8_t data[UPLINK_MAX_FRAME];
+  uint16_t length;
+};
+
+static PendingFrame pending[MQTT_UPLINK_PENDING_SLOTS];
+static uint8_t pendingHead = 0;   // next slot to fill
+static uint8_t pendingCount = 0;
+static uint32_t droppedFrames = 0;
+
+// The ring is touched from the processing task, the ESP-NOW gateway
+// task and the esp-mqtt event task (CONNECTED flush). Same idiom as
+// gg_log.cpp: a short critical section around the accounting and slot
+// copies — never around a network call.
+static portMUX_TYPE pendingMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Single-drainer claim (guarded by pendingMux): the CONNECTED event
+// and a publish from another task can race into flushPending(), and
+// two drainers would publish the same tail twice then retire an
+// unpublished frame with the second decrement
+static bool flushInProgress = false;
+
+static bool publishNow(const uint8_t *data, size_t len) {
+  // QoS 1, no retain; esp-mqtt handles the ack/retry state machine
+  int msgId = esp_mqtt_client_publish(mqttClient, readingsTopic,
+                                      (const char *)data, len, 1, 0);
+  return msgId >= 0;
+}
+
+/**
+ * Flush queued frames oldest-first once the session is back. The tail
+ * frame is copied out under the mux and published from the stack, so
+ * the (possibly blocking) publish never holds the critical section
+ * and a concurrent producer overwriting the slot cannot tear it.
+ *
+ * Exactly one task drains at a time: a second caller finds the claim
+ * taken and bails — the drainer already running will carry its frames
+ * out, so there is nothing for the loser to do.
+ */
+static void flushPending() {
+  portENTER_CRITICAL(&pendingMux);
+  if (flushInProgress) {
+    portEXIT_CRITICAL(&pendingMux);
+    return;
+  }
+  flushInProgress = true;
+  portEXIT_CRITICAL(&pendingMux);
+
+  for (;;) {
+    PendingFrame frame;
+
+    portENTER_CRITICAL(&pendingMux);
+    if (pendingCount == 0 || !connected) {
+      flushInProgress = false;
+      portEXIT_CRITICAL(&pendingMux);
+      return;
+    }
+    uint8_t tail = (uint8_t)((pendingHead + MQTT_UPLINK_PENDING_SLOTS -
+                              pendingCount) % MQTT_UPLINK_PENDING_SLOTS);
+    frame = pending[tail];
+    portEXIT_CRITICAL(&pendingMux);
+
+    if (!publishNow(frame.data, frame.length)) {
+      // Broker backpressure; retry on next event
+      portENTER_CRITICAL(&pendingMux);
+      flushInProgress = false;
+      portEXIT_CRITICAL(&pendingMux);
+      return;
+    }
+
+    // If a full-ring producer dropped-oldest while we published, this
+    // retires the successor instead — under overflow a frame was being
+    // lost either way, and the accounting stays consistent
+    portENTER_CRITICAL(&pendingMux);
+    if (pendingCount > 0) pendingCount--;
+    portEXIT_CRITICAL(&pendingMux);
+  }
+}
+
+// ============================================================================
+// MQTT EVENT HANDLER
+// ============================================================================
+
+static void mqttEventHandler(void *arg, esp_event_base_t base,
+                             int32_t eventId, void *eventData) {
+  switch ((esp_mqtt_event_id_t)eventId) {
+    case MQTT_EVENT_CONNECTED:
+      connected = true;
+      Serial.println("✅ MQTT session established");
+      for (uint8_t i = 0; i < downlinkCount; i++) {
+        esp_mqtt_client_subscribe(mqttClient, downlinks[i].topic, 1);
+      }
+      flushPending();
+      break;
+
+    case MQTT_EVENT_DISCONNECTED:
+      connected = false;
+      Serial.println("⚠️  MQTT session lost, frames will queue");
+      break;
+
+    case MQTT_EVENT_DATA: {
+      if (downlinkCount == 0) break;
+      esp_mqtt_event_handle_t event = (esp_mqtt_event_handle_t)eventData;
+
+      // Continuation fragments of a large payload carry no topic —
+      // they belong to the last suffix seen
+      if (event->topic_len > 0) {
+        const char *slash = NULL;
+        for (int i = event->topic_len - 1; i >= 0; i--) {
+          if (event->topic[i] == '/') {
+            slash = &event->topic[i + 1];
+            break;
+          }
+        }
+        size_t suffixLen = slash
+            ? (size_t)(event->topic + event->topic_len - slash) : 0;
+        if (suffixLen == 0 || suffixLen >= sizeof(lastSuffix)) break;
+        memcpy(lastSuffix, slash, suffixLen);
+        lastSuffix[suffixLen] = '\0';
+      }
+
+      for (uint8_t i = 0; i < downlinkCount; i++) {
+        if (strcmp(downlinks[i].suffix, lastSuffix) == 0) {
+          downlinks[i].handler(lastSuffix, (const uint8_t *)event->data,
+                               event->data_len);
+          break;
+        }
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+bool mqttUplinkBegin(const char *brokerUri, const char *clientId) {
+  if (mqttClient != NULL) return true;  // Already running
+
+  snprintf(readingsTopic, sizeof(readingsTopic),
+           "gasguard/%s/readings", clientId);
+  snprintf(clientIdCopy, sizeof(clientIdCopy), "%s", clientId);
+
+  esp_mqtt_client_config_t config = {};
+  config.uri = brokerUri;
+  config.client_id = clientId;
+  config.disable_clean_session = true;   // persistent session
+  config.keepalive = 30;
+
+  mqttClient = esp_mqtt_client_init(&config);
+  if (mqttClient == NULL) {
+    Serial.println("❌ MQTT: client init failed");
+    return false;
+  }
+
+  esp_mqtt_client_register_event(mqttClient,
+                                 (esp_mqtt_event_id_t)ESP_EVENT_ANY_ID,
+                                 mqttEventHandler, NULL);
+  esp_mqtt_client_start(mqttClient);
+
+  Serial.printf("📡 MQTT uplink -> %s (%s)\n", brokerUri, readingsTopic);
+  return true;
+}
+
+bool mqttUplinkPublishFrame(const uint8_t *data, size_t len) {
+  if (len > UPLINK_MAX_FRAME) return false;
+
+  portENTER_CRITICAL(&pendingMux);
+  bool direct = connected && pendingCount == 0;
+  portEXIT_CRITICAL(&pendingMux);
+
+  if (direct && publishNow(data, len)) {
+    return true;
+  }
+
+  // Backpressure: park the frame in a static slot, oldest dropped first
+  portENTER_CRITICAL(&pendingMux);
+  if (pendingCount == MQTT_UPLINK_PENDING_SLOTS) {
+    pendingCount--;
+    droppedFrames++;
+  }
+
+  memcpy(pending[pendingHead].data, data, len);
+  pending[pendingHead].length = (uint16_t)len;
+  pendingHead = (uint8_t)((pendingHead + 1) % MQTT_UPLINK_PENDING_SLOTS);
+  pendingCount++;
+  portEXIT_CRITICAL(&pendingMux);
+
+  if (connected) {
+    flushPending();
+  }
+
+  return true;
+}
+
+bool mqttUplinkPublishEvent(const char *topicSuffix,
+                            const uint8_t *data, size_t len) {
+  if (!connected || mqttClient == NULL) return false;
+
+  char topic[80];
+  snprintf(topic, sizeof(topic), "gasguard/%s/%s", clientIdCopy, topicSuffix);
+
+  return esp_mqtt_client_publish(mqttClient, topic,
+                                 (const char *)data, len, 1, 0) >= 0;
+}
+
+void mqttUplinkOnDownlink(const char *topicSuffix,
+                          MqttDownlinkHandler handler) {
+  if (downlinkCount == MQTT_DOWNLINK_SLOTS) return;
+
+  DownlinkSlot &slot = downlinks[downlinkCount];
+  snprintf(slot.suffix, sizeof(slot.suffix), "%s", topicSuffix);
+  snprintf(slot.topic, sizeof(slot.topic), "gasguard/%s/%s",
+           clientIdCopy, topicSuffix);
+  slot.handler = handler;
+  downlinkCount++;
+
+  if (connected) {
+    esp_mqtt_client_subscribe(mqttClient, slot.topic, 1);
+  }
+}
+
+uint32_t mqttUplinkDroppedFrames() {
+  return droppedFrames;
+}
+
+bool mqttUplinkConnected() {
+  return connected;
+}
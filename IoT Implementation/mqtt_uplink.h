@@ -0,0 +1,83 @@
+/**
+ * GasGuard - Persistent MQTT Uplink
+ *
+ * Transport for the batched binary uplink frames (uplink_codec.h),
+ * built on the native esp-mqtt client rather than HTTP POST:
+ *
+ *   - one persistent session for the node's lifetime (clean_session
+ *     off, automatic reconnect) — no per-send connection churn
+ *   - frames publish straight from preallocated static slots: no
+ *     String, no malloc per message, nothing to fragment the heap
+ *   - QoS 1 publishes, so a frame survives a broker hiccup without
+ *     the firmware re-sending it by hand
+ *   - under backpressure (link down, broker slow) frames coalesce in
+ *     a fixed slot ring, oldest dropped first — sampling and encoding
+ *     never block on the network
+ *
+ * Topic layout: gasguard/<clientId>/readings
+ */
+
+#ifndef GASGUARD_MQTT_UPLINK_H
+#define GASGUARD_MQTT_UPLINK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Pending-frame slots while disconnected (static allocation)
+#define MQTT_UPLINK_PENDING_SLOTS 8
+
+/**
+ * Start the persistent session. `brokerUri` like "mqtt://192.168.1.10",
+ * `clientId` is the zone/node ID the backend knows (e.g. "ZONE_A_01").
+ * Requires Wi-Fi to be up. Returns false if the client could not be
+ * created.
+ */
+bool mqttUplinkBegin(const char *brokerUri, const char *clientId);
+
+/**
+ * Queue one encoded uplink frame for publish. Copies into a static
+ * slot (no heap) and publishes immediately when the session is up;
+ * otherwise the frame waits in the slot ring and is flushed on
+ * reconnect. Never blocks. Returns false only if the frame is larger
+ * than a slot.
+ */
+bool mqttUplinkPublishFrame(const uint8_t *data, size_t len);
+
+/**
+ * Direct publish of an infrequent event payload (e.g. flight-recorder
+ * chunks) on gasguard/<clientId>/<topicSuffix>. QoS 1, no queueing:
+ * returns false when the session is down and the caller should retry.
+ */
+bool mqttUplinkPublishEvent(const char *topicSuffix,
+                            const uint8_t *data, size_t len);
+
+// Registered downlink command topics (ota, vent, ...)
+#define MQTT_DOWNLINK_SLOTS 4
+
+/**
+ * Downlink handler: called from the MQTT task with the topic suffix
+ * (the part after gasguard/<clientId>/) and the payload bytes. Large
+ * payloads may arrive in multiple calls — handlers must be streaming.
+ */
+typedef void (*MqttDownlinkHandler)(const char *topicSuffix,
+                                    const uint8_t *data, size_t len);
+
+/**
+ * Register a handler for one command topic and subscribe to
+ * gasguard/<clientId>/<topicSuffix>. Fixed slots (MQTT_DOWNLINK_SLOTS);
+ * the OTA applier and the ventilation controller register here.
+ */
+void mqttUplinkOnDownlink(const char *topicSuffix,
+                          MqttDownlinkHandler handler);
+
+/**
+ * Frames dropped because the pending ring overflowed while offline.
+ */
+uint32_t mqttUplinkDroppedFrames();
+
+/**
+ * True while the broker session is established.
+ */
+bool mqttUplinkConnected();
+
+#endif // GASGUARD_MQTT_UPLINK_H
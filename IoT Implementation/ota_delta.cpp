@@ -0,0 +1,265 @@
+/**
+ * GasGuard - Incremental OTA Delta Updates (implementation)
+ *
+ * esp_ota_write() must be sequential, so reconstruction walks the
+ * target image front to back: when a patch record for page k arrives,
+ * pages nextPage..k-1 are first copied from the running partition,
+ * then the patch page is written. After the last record the remaining
+ * base pages are copied out to targetSize. One static 4 KB page buffer
+ * is the only working memory.
+ */
+
+#include <Arduino.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+
+#include "ota_delta.h"
+#include "mqtt_uplink.h"
+#include "gg_crc32.h"
+
+enum OtaState { OTA_IDLE, OTA_HEADER, OTA_RECORD_HEADER, OTA_RECORD_DATA };
+
+struct OtaRecordHeader {
+  uint32_t pageIndex;
+  uint32_t dataLen;
+};
+
+static OtaState state = OTA_IDLE;
+static OtaDeltaHeader header;
+static OtaRecordHeader record;
+static size_t accumulated = 0;       // bytes of the current structure
+static uint32_t patchReceived = 0;   // total patch bytes consumed
+static uint32_t nextPage = 0;        // next target page to write
+static uint32_t rollingCrc = 0;
+static uint32_t imageWritten = 0;
+
+static const esp_partition_t *updatePartition = NULL;
+static esp_ota_handle_t otaHandle = 0;
+
+static uint8_t pageBuf[OTA_PAGE_SIZE];
+
+static uint32_t crc32Partition(const esp_partition_t *part, uint32_t size) {
+  uint32_t crc = 0;
+  for (uint32_t off = 0; off < size; off += OTA_PAGE_SIZE) {
+    uint32_t n = size - off < OTA_PAGE_SIZE ? size - off : OTA_PAGE_SIZE;
+    if (esp_partition_read(part, off, pageBuf, n) != ESP_OK) return 0;
+    crc = ggCrc32Update(crc, pageBuf, n);
+  }
+  return crc;
+}
+
+// ============================================================================
+// RECONSTRUCTION
+// ============================================================================
+
+static void otaReset() {
+  if (state != OTA_IDLE && otaHandle != 0) {
+    esp_ota_abort(otaHandle);
+  }
+  state = OTA_IDLE;
+  accumulated = 0;
+  patchReceived = 0;
+  nextPage = 0;
+  rollingCrc = 0;
+  imageWritten = 0;
+  otaHandle = 0;
+}
+
+static bool writeImage(const uint8_t *data, uint32_t len) {
+  if (esp_ota_write(otaHandle, data, len) != ESP_OK) return false;
+  rollingCrc = ggCrc32Update(rollingCrc, data, len);
+  imageWritten += len;
+  return true;
+}
+
+/**
+ * Copy base pages [from, to) from the running partition into the
+ * target, clipped to targetSize
+ */
+static bool copyBasePages(uint32_t from, uint32_t to) {
+  const esp_partition_t *running = esp_ota_get_running_partition();
+
+  for (uint32_t page = from; page < to; page++) {
+    uint32_t off = page * OTA_PAGE_SIZE;
+    if (off >= header.targetSize) break;
+
+    uint32_t n = header.targetSize - off < OTA_PAGE_SIZE
+                     ? header.targetSize - off
+                     : OTA_PAGE_SIZE;
+    if (esp_partition_read(running, off, pageBuf, n) != ESP_OK) return false;
+    if (!writeImage(pageBuf, n)) return false;
+  }
+  return true;
+}
+
+static bool otaStart() {
+  if (header.magic != OTA_DELTA_MAGIC ||
+      header.version != OTA_DELTA_VERSION) {
+    Serial.println("❌ OTA: bad patch header");
+    return false;
+  }
+
+  // The patch must have been built against exactly this image
+  const esp_partition_t *running = esp_ota_get_running_partition();
+  uint32_t baseCrc = crc32Partition(running, header.baseSize);
+  if (baseCrc != header.baseCrc32) {
+    Serial.printf("❌ OTA: base mismatch (running %08x, patch wants %08x) "
+                  "— node needs a full image\n", baseCrc, header.baseCrc32);
+    return false;
+  }
+
+  updatePartition = esp_ota_get_next_update_partition(NULL);
+  if (updatePartition == NULL ||
+      esp_ota_begin(updatePartition, header.targetSize, &otaHandle) != ESP_OK) {
+    Serial.println("❌ OTA: cannot open update partition");
+    return false;
+  }
+
+  Serial.printf("📦 OTA: applying %u B delta -> %u B image\n",
+                header.deltaSize, header.targetSize);
+  return true;
+}
+
+static bool otaFinish() {
+  // Remaining unchanged tail comes from the running image
+  uint32_t lastPage = (header.targetSize + OTA_PAGE_SIZE - 1) / OTA_PAGE_SIZE;
+  if (!copyBasePages(nextPage, lastPage)) return false;
+
+  if (rollingCrc != header.targetCrc32) {
+    Serial.printf("❌ OTA: reconstructed CRC %08x != expected %08x\n",
+                  rollingCrc, header.targetCrc32);
+    return false;
+  }
+
+  if (esp_ota_end(otaHandle) != ESP_OK ||
+      esp_ota_set_boot_partition(updatePartition) != ESP_OK) {
+    Serial.println("❌ OTA: partition switch failed");
+    otaHandle = 0;
+    return false;
+  }
+  otaHandle = 0;
+
+  Serial.println("✅ OTA: image verified, rebooting into new firmware");
+  Serial.flush();
+  delay(100);
+  esp_restart();
+  return true;   // not reached
+}
+
+// ============================================================================
+// STREAMING FEED
+// ============================================================================
+
+/**
+ * Consume up to `len` bytes into a fixed-size structure; returns how
+ * many were taken and sets *complete when the structure is full
+ */
+static size_t fill(uint8_t *dst, size_t dstSize, const uint8_t *src,
+                   size_t len, bool *complete) {
+  size_t need = dstSize - accumulated;
+  size_t take = len < need ? len : need;
+  memcpy(dst + accumulated, src, take);
+  accumulated += take;
+  *complete = (accumulated == dstSize);
+  return take;
+}
+
+bool otaDeltaFeed(const uint8_t *data, size_t len) {
+  while (len > 0) {
+    bool complete = false;
+    size_t took = 0;
+
+    switch (state) {
+      case OTA_IDLE:
+        state = OTA_HEADER;
+        accumulated = 0;
+        // fall through to header accumulation
+      case OTA_HEADER:
+        took = fill((uint8_t *)&header, sizeof(header), data, len, &complete);
+        if (complete) {
+          if (!otaStart()) {
+            otaReset();
+            return false;
+          }
+          state = OTA_RECORD_HEADER;
+          accumulated = 0;
+        }
+        break;
+
+      case OTA_RECORD_HEADER:
+        took = fill((uint8_t *)&record, sizeof(record), data, len, &complete);
+        if (complete) {
+          if (record.pageIndex < nextPage ||
+              record.dataLen > OTA_PAGE_SIZE) {
+            Serial.println("❌ OTA: malformed patch record");
+            otaReset();
+            return false;
+          }
+          state = OTA_RECORD_DATA;
+          accumulated = 0;
+        }
+        break;
+
+      case OTA_RECORD_DATA:
+        took = fill(pageBuf, record.dataLen, data, len, &complete);
+        if (complete) {
+          // Unchanged pages before this one come from the base image
+          if (!copyBasePages(nextPage, record.pageIndex) ||
+              !writeImage(pageBuf, record.dataLen)) {
+            Serial.println("❌ OTA: flash write failed");
+            otaReset();
+            return false;
+          }
+          nextPage = record.pageIndex + 1;
+          state = OTA_RECORD_HEADER;
+          accumulated = 0;
+        }
+        break;
+    }
+
+    data += took;
+    len -= took;
+    patchReceived += took;
+
+    if (state != OTA_HEADER && patchReceived >= header.deltaSize) {
+      bool ok = otaFinish();
+      otaReset();
+      return ok;
+    }
+  }
+  return true;
+}
+
+bool otaDeltaInProgress() {
+  return state != OTA_IDLE;
+}
+
+void otaDeltaAbort() {
+  if (state != OTA_IDLE) {
+    Serial.println("⚠️  OTA: patch aborted");
+    otaReset();
+  }
+}
+
+uint32_t otaDeltaProgress() {
+  return patchReceived;
+}
+
+// ============================================================================
+// TRANSPORT + BOOT CONFIRMATION
+// ============================================================================
+
+static void otaDownlinkHandler(const char *topicSuffix, const uint8_t *data,
+                               size_t len) {
+  otaDeltaFeed(data, len);
+}
+
+void otaDeltaBindDownlink() {
+  mqttUplinkOnDownlink("ota", otaDownlinkHandler);
+}
+
+void otaDeltaConfirmBoot() {
+  // No-op unless the bootloader has a pending-verify image; then this
+  // is what keeps the rollback from firing on the next reset
+  esp_ota_mark_app_valid_cancel_rollback();
+}
@@ -0,0 +1,95 @@
+/**
+ * GasGuard - Incremental OTA Delta Updates
+ *
+ * Reflashing 400 nodes over USB costs a technician-weekend per rollout,
+ * so firmware improvements rot unshipped. This subsystem applies binary
+ * delta patches over the air: the patch carries only the 4 KB pages
+ * that changed between the running image and the target, and the
+ * device reconstructs the full target into the inactive OTA partition
+ * by interleaving patch pages with pages copied from the running
+ * partition. A typical tuning change touches a handful of pages, so a
+ * patch is tens of KB instead of a ~1.3 MB full image — small enough
+ * to ship over the same constrained Wi-Fi the sensor traffic uses.
+ *
+ * Safety rails:
+ *   - the patch names the CRC32 of the base image it was built
+ *     against; a mismatch (node runs a different build) aborts before
+ *     a byte is written
+ *   - a rolling CRC32 accumulates over the reconstructed image as it
+ *     is written; it must equal the patch's target CRC before the boot
+ *     partition switches
+ *   - dual-partition fallback: the old image stays intact in the
+ *     other slot, and otaDeltaConfirmBoot() (called from setup() once
+ *     the node is demonstrably healthy) cancels the bootloader
+ *     rollback — a broken update reboots into the previous image
+ *
+ * The applier is a streaming state machine: feed it patch bytes in any
+ * chunking (MQTT downlink, HTTP, serial) via otaDeltaFeed(). Delta
+ * patches are produced by ota-tools/make_delta.py; campaigns are paced
+ * by ota-tools/fleet_rollout.py.
+ */
+
+#ifndef GASGUARD_OTA_DELTA_H
+#define GASGUARD_OTA_DELTA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define OTA_DELTA_MAGIC     0x47474431u   // "GGD1"
+#define OTA_DELTA_VERSION   1
+#define OTA_PAGE_SIZE       4096
+
+/**
+ * Patch header (little-endian, 32 bytes), followed by pageCount
+ * records in ascending page order:
+ *   { uint32 pageIndex; uint32 dataLen; uint8 data[dataLen]; }
+ */
+struct OtaDeltaHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t reserved;
+  uint32_t baseCrc32;     // CRC32 of the image this patch applies to
+  uint32_t targetCrc32;   // CRC32 the reconstructed image must match
+  uint32_t baseSize;
+  uint32_t targetSize;
+  uint32_t deltaSize;     // total patch bytes including this header
+};
+
+/**
+ * Feed patch bytes as they arrive. The first bytes must be the header
+ * (the applier arms itself when it sees the magic); application,
+ * verification, partition switch and reboot all happen from inside the
+ * final feed. Returns false if the patch was rejected (wrong base,
+ * bad structure, flash error) — the applier resets and the running
+ * image is untouched.
+ */
+bool otaDeltaFeed(const uint8_t *data, size_t len);
+
+/**
+ * True while a patch is partially applied.
+ */
+bool otaDeltaInProgress();
+
+/**
+ * Drop a partially received patch (e.g. campaign cancelled).
+ */
+void otaDeltaAbort();
+
+/**
+ * Bytes of the current patch received so far (diagnostics).
+ */
+uint32_t otaDeltaProgress();
+
+/**
+ * Route the MQTT "ota" downlink into the applier. Call from setup()
+ * after mqttUplinkBegin().
+ */
+void otaDeltaBindDownlink();
+
+/**
+ * Declare this boot healthy and cancel the bootloader rollback. Call
+ * from setup() after the sensor pipeline is up.
+ */
+void otaDeltaConfirmBoot();
+
+#endif // GASGUARD_OTA_DELTA_H
@@ -0,0 +1,159 @@
+/**
+ * GasGuard - Compile-Time PPM Lookup Tables
+ *
+ * Replaces the pow() call in convertToPPM() with a constexpr-generated
+ * per-sensor lookup table. The curve PPM = A * (Rs/R0)^B is sampled at
+ * compile time on a log2-spaced grid over the realistic Rs/R0 range
+ * (1/32 to 32); a runtime conversion is then:
+ *
+ *   1. fast log2(ratio)  — exponent bits + small mantissa table lerp
+ *   2. table lerp        — two loads and a multiply-add
+ *
+ * No libm call, no softfloat pow, and a deterministic cycle count per
+ * reading. Table error is < 0.1%, far below MQ sensor accuracy.
+ *
+ * All generation math (exp/log Taylor series) is constexpr and runs in
+ * the compiler; none of it is linked into the firmware image.
+ */
+
+#ifndef GASGUARD_PPM_LUT_H
+#define GASGUARD_PPM_LUT_H
+
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// COMPILE-TIME MATH (generation only — never executed on device)
+// ============================================================================
+
+namespace ppm_lut_detail {
+
+constexpr double CX_LN2 = 0.6931471805599453;
+
+/**
+ * exp(x) for |x| <= ln2, Taylor series
+ */
+constexpr double cxExp(double x) {
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; k <= 14; k++) {
+    term *= x / k;
+    sum += term;
+  }
+  return sum;
+}
+
+/**
+ * 2^x for arbitrary x: integer shift + fractional Taylor
+ */
+constexpr double cxPow2(double x) {
+  int ip = (int)x;
+  if (x < 0 && x != ip) ip -= 1;   // floor
+  double fp = x - ip;
+
+  double result = cxExp(fp * CX_LN2);
+  for (int i = 0; i < ip; i++) result *= 2.0;
+  for (int i = 0; i > ip; i--) result *= 0.5;
+  return result;
+}
+
+/**
+ * log2(m) for m in [1, 2), via artanh series
+ */
+constexpr double cxLog2(double m) {
+  double z = (m - 1.0) / (m + 1.0);
+  double z2 = z * z;
+  double term = z;
+  double sum = z;
+  for (int k = 3; k <= 17; k += 2) {
+    term *= z2;
+    sum += term / k;
+  }
+  return (2.0 * sum) / CX_LN2;
+}
+
+} // namespace ppm_lut_detail
+
+// ============================================================================
+// MANTISSA LOG TABLE (shared by all sensors)
+// ============================================================================
+
+struct MantissaLog2Lut {
+  static const int SIZE = 64;      // intervals over mantissa [1, 2)
+  float entry[SIZE + 1];
+};
+
+constexpr MantissaLog2Lut mantissaLog2Build() {
+  MantissaLog2Lut lut = {};
+  for (int i = 0; i <= MantissaLog2Lut::SIZE; i++) {
+    lut.entry[i] = (float)ppm_lut_detail::cxLog2(1.0 + (double)i / MantissaLog2Lut::SIZE);
+  }
+  return lut;
+}
+
+/**
+ * Fast log2 for positive finite floats: IEEE-754 exponent bits plus a
+ * lerped mantissa table. ~0.01% accurate, a handful of integer ops.
+ */
+inline float fastLog2(float x) {
+  uint32_t bits = 0;
+  memcpy(&bits, &x, sizeof(bits));
+
+  int exponent = (int)((bits >> 23) & 0xFF) - 127;
+  uint32_t mantissa = bits & 0x007FFFFF;
+
+  static constexpr MantissaLog2Lut mlut = mantissaLog2Build();
+
+  // Top bits index the table, remaining bits lerp between entries
+  uint32_t idx = mantissa >> (23 - 6);          // 6 = log2(SIZE)
+  float frac = (float)(mantissa & ((1u << 17) - 1)) / (float)(1u << 17);
+
+  float lo = mlut.entry[idx];
+  float hi = mlut.entry[idx + 1];
+  return exponent + lo + (hi - lo) * frac;
+}
+
+// ============================================================================
+// PER-SENSOR PPM TABLE
+// ============================================================================
+
+struct PpmLut {
+  static const int SIZE = 256;     // intervals over log2(ratio), ~1 KB/sensor
+  static constexpr float LOG2_MIN = -5.0f;   // ratio = 1/32
+  static constexpr float LOG2_MAX = 5.0f;    // ratio = 32
+  float entry[SIZE + 1];
+};
+
+/**
+ * Sample PPM = A * 2^(B * log2(ratio)) at compile time on the log2 grid
+ */
+constexpr PpmLut ppmLutBuild(double A, double B) {
+  PpmLut lut = {};
+  for (int i = 0; i <= PpmLut::SIZE; i++) {
+    double l = PpmLut::LOG2_MIN +
+               (PpmLut::LOG2_MAX - PpmLut::LOG2_MIN) * i / PpmLut::SIZE;
+    double ppm = A * ppm_lut_detail::cxPow2(B * l);
+    lut.entry[i] = (float)(ppm < 0 ? 0 : ppm);
+  }
+  return lut;
+}
+
+/**
+ * Runtime lookup: fast log2 + table lerp. Out-of-range ratios clamp to
+ * the table ends (the curve is monotonic, so this saturates sanely).
+ */
+inline float ppmLutLookup(const PpmLut &lut, float ratio) {
+  if (ratio <= 0) return 0.0f;
+
+  float t = (fastLog2(ratio) - PpmLut::LOG2_MIN) *
+            (PpmLut::SIZE / (PpmLut::LOG2_MAX - PpmLut::LOG2_MIN));
+
+  if (t <= 0) return lut.entry[0];
+  if (t >= PpmLut::SIZE) return lut.entry[PpmLut::SIZE];
+
+  int i = (int)t;
+  float frac = t - i;
+  return lut.entry[i] + (lut.entry[i + 1] - lut.entry[i]) * frac;
+}
+
+#endif // GASGUARD_PPM_LUT_H
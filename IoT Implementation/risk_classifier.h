@@ -0,0 +1,96 @@
+/**
+ * GasGuard - On-Device Risk-State Classifier
+ *
+ * Firmware mirror of the backend's PPM threshold table (see the ML
+ * Classification section of ARCHITECTURE.md). Evaluating the same six
+ * risk states locally costs microseconds and keeps safety actuation
+ * working when Wi-Fi is down — the network round trip through the
+ * backend and ML service is no longer on the critical path.
+ *
+ * The thresholds MUST stay in lockstep with ml-service; the table below
+ * is the NORMAL..CRITICAL band-edge table from ARCHITECTURE.md verbatim.
+ *
+ * Overall risk = max risk across all 4 gases, same fusion rule as the
+ * backend's PPM path.
+ */
+
+#ifndef GASGUARD_RISK_CLASSIFIER_H
+#define GASGUARD_RISK_CLASSIFIER_H
+
+#include "gas_readings.h"
+
+// Same ordering and numeric values as the backend (risk_level 0-5)
+enum RiskState {
+  RISK_NORMAL      = 0,
+  RISK_LOW_ANOMALY = 1,
+  RISK_UNUSUAL     = 2,
+  RISK_ALERT       = 3,
+  RISK_WARNING     = 4,
+  RISK_CRITICAL    = 5,
+};
+
+/**
+ * Band edges for one gas: ppm < lowAnomaly is NORMAL, ppm >= critical
+ * is CRITICAL, and so on in between
+ */
+struct GasThresholds {
+  float lowAnomaly;
+  float unusual;
+  float alert;
+  float warning;
+  float critical;
+};
+
+// Threshold table from ARCHITECTURE.md (PPM)
+constexpr GasThresholds METHANE_THRESHOLDS = { 1000, 2500, 4000, 5000, 7000 };
+constexpr GasThresholds LPG_THRESHOLDS     = {  500, 1000, 1500, 2000, 3000 };
+constexpr GasThresholds CO_THRESHOLDS      = {   25,   35,   50,  100,  200 };
+constexpr GasThresholds H2S_THRESHOLDS     = {    5,   10,   15,   20,   50 };
+
+/**
+ * Classify one gas channel against its band edges
+ */
+constexpr RiskState classifyChannel(float ppm, const GasThresholds &t) {
+  return ppm >= t.critical   ? RISK_CRITICAL
+       : ppm >= t.warning    ? RISK_WARNING
+       : ppm >= t.alert      ? RISK_ALERT
+       : ppm >= t.unusual    ? RISK_UNUSUAL
+       : ppm >= t.lowAnomaly ? RISK_LOW_ANOMALY
+       :                       RISK_NORMAL;
+}
+
+/**
+ * Overall risk for a snapshot: max across all 4 gases (backend fusion
+ * rule). Invalid snapshots classify as NORMAL — the backend treats
+ * missing data the same way.
+ */
+constexpr RiskState classifyReadings(const GasReadings &r) {
+  RiskState risk = RISK_NORMAL;
+  if (!r.valid) return risk;
+
+  RiskState ch = classifyChannel(r.methane, METHANE_THRESHOLDS);
+  if (ch > risk) risk = ch;
+  ch = classifyChannel(r.lpg, LPG_THRESHOLDS);
+  if (ch > risk) risk = ch;
+  ch = classifyChannel(r.carbonMonoxide, CO_THRESHOLDS);
+  if (ch > risk) risk = ch;
+  ch = classifyChannel(r.hydrogenSulfide, H2S_THRESHOLDS);
+  if (ch > risk) risk = ch;
+
+  return risk;
+}
+
+/**
+ * Backend-compatible state name (matches the riskState enum strings in
+ * the MongoDB schemas)
+ */
+constexpr const char *riskStateName(RiskState state) {
+  return state == RISK_CRITICAL    ? "CRITICAL"
+       : state == RISK_WARNING     ? "WARNING"
+       : state == RISK_ALERT       ? "ALERT"
+       : state == RISK_UNUSUAL     ? "UNUSUAL"
+       : state == RISK_LOW_ANOMALY ? "LOW_ANOMALY"
+       :                             "NORMAL";
+}
+
+#endif // GASGUARD_RISK_CLASSIFIER_H
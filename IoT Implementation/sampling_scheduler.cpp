@@ -0,0 +1,71 @@
+/**
+ * GasGuard - Interleaved Multi-Channel Sampling Scheduler (implementation)
+ */
+
+#include <Arduino.h>
+
+#include "sampling_scheduler.h"
+#include "adc_sampler.h"
+
+// Mirror the sampling constants in sensor_ppm_converter.cpp
+#define SCHED_NUM_SAMPLES   10
+#define SCHED_SAMPLE_DELAY  50
+#define SCHED_V_REF         3.3
+#define SCHED_ADC_MAX       4095.0
+
+static int schedPins[SCHED_NUM_CHANNELS];
+static size_t schedNumPins = 0;
+
+void samplingSchedulerBegin(const int *pins, size_t numPins) {
+  if (numPins > SCHED_NUM_CHANNELS) numPins = SCHED_NUM_CHANNELS;
+
+  for (size_t i = 0; i < numPins; i++) {
+    schedPins[i] = pins[i];
+  }
+  schedNumPins = numPins;
+}
+
+/**
+ * Round-robin fallback: one analogRead per channel per tick, so all
+ * channels accumulate NUM_SAMPLES within a single window rather than
+ * each channel paying for its own window.
+ */
+static void interleavedWindowSnapshot(float *voltages) {
+  int sums[SCHED_NUM_CHANNELS] = {0};
+
+  for (int sample = 0; sample < SCHED_NUM_SAMPLES; sample++) {
+    for (size_t ch = 0; ch < schedNumPins; ch++) {
+      sums[ch] += analogRead(schedPins[ch]);
+    }
+    delay(SCHED_SAMPLE_DELAY);
+  }
+
+  for (size_t ch = 0; ch < schedNumPins; ch++) {
+    float avgValue = sums[ch] / (float)SCHED_NUM_SAMPLES;
+    voltages[ch] = avgValue * (SCHED_V_REF / SCHED_ADC_MAX);
+  }
+}
+
+void samplingSchedulerSnapshot(float *voltages) {
+  for (size_t ch = 0; ch < SCHED_NUM_CHANNELS; ch++) {
+    voltages[ch] = -1.0;
+  }
+  if (schedNumPins == 0) return;
+
+  // Fast path: per-channel streaming filters are updated per-sample by
+  // the DMA drain task, so a snapshot is four O(1) reads of already
+  // glitch-rejected estimates
+  bool dmaLive = true;
+  for (size_t ch = 0; ch < schedNumPins; ch++) {
+    float v = adcSamplerFilteredVoltage(schedPins[ch]);
+    if (v < 0) {
+      dmaLive = false;
+      break;
+    }
+    voltages[ch] = v;
+  }
+
+  if (!dmaLive) {
+    interleavedWindowSnapshot(voltages);
+  }
+}
@@ -0,0 +1,49 @@
+/**
+ * GasGuard - Interleaved Multi-Channel Sampling Scheduler
+ *
+ * Produces a complete 4-channel voltage snapshot in ONE sampling window
+ * instead of four sequential 500 ms windows.
+ *
+ * When the DMA sampling engine is running (adc_sampler.h), all channels
+ * are already scanned concurrently by the ADC1 pattern table, so a
+ * snapshot is just four ring-buffer lookups. If the DMA engine is down,
+ * the scheduler falls back to a round-robin interleave: one sample per
+ * channel per tick, so the whole snapshot still costs a single
+ * NUM_SAMPLES * SAMPLE_DELAY window.
+ */
+
+#ifndef GASGUARD_SAMPLING_SCHEDULER_H
+#define GASGUARD_SAMPLING_SCHEDULER_H
+
+#include <stddef.h>
+
+// Channel order used throughout the firmware:
+// 0 = MQ-4 (CH4), 1 = MQ-6 (LPG), 2 = MQ-7 (CO), 3 = MQ-136 (H2S)
+#define SCHED_NUM_CHANNELS 4
+
+#define SCHED_CH_MQ4   0
+#define SCHED_CH_MQ6   1
+#define SCHED_CH_MQ7   2
+#define SCHED_CH_MQ136 3
+
+/**
+ * Register the sensor pins, in the channel order above.
+ * Call once from setup() before the first snapshot.
+ */
+void samplingSchedulerBegin(const int *pins, size_t numPins);
+
+/**
+ * Fill `voltages[SCHED_NUM_CHANNELS]` with one coherent snapshot.
+ *
+ * DMA path: returns immediately with each channel's latest averaged
+ * window (all windows cover the same time span, so the snapshot is
+ * time-aligned across channels).
+ *
+ * Fallback path: blocks for one NUM_SAMPLES * SAMPLE_DELAY window,
+ * interleaving channels round-robin within it.
+ *
+ * Invalid channels are reported as -1.0, matching readVoltage().
+ */
+void samplingSchedulerSnapshot(float *voltages);
+
+#endif // GASGUARD_SAMPLING_SCHEDULER_H
@@ -0,0 +1,112 @@
+/**
+ * GasGuard - Sensor-Health & Drift Engine (implementation)
+ *
+ * Baseline Rs comes from the DMA sampler's filtered counts (the same
+ * number the conversion path sees), so the engine measures exactly the
+ * drift the PPM math suffers. Everything runs on the processing task;
+ * a full NORMAL-cycle update is four EWMA steps and four divides.
+ */
+
+#include <Arduino.h>
+
+#include "sensor_health.h"
+#include "adc_sampler.h"
+
+// Same electrical constants as the conversion path (RL = 10 kΩ on a
+// 3.3 V / 12-bit ADC)
+#define HEALTH_V_REF   3.3f
+#define HEALTH_ADC_MAX 4095.0f
+#define HEALTH_RL      10.0f
+
+static int channelPins[CALIBRATION_CHANNELS];
+static size_t channelCount = 0;
+
+static float baselineRs[CALIBRATION_CHANNELS];   // slow clean-air EWMA
+static uint32_t updates[CALIBRATION_CHANNELS];   // EWMA steps so far
+
+/** Clean-air Rs (kΩ) from the filtered counts; <0 when not measurable */
+static float filteredRs(int pin) {
+  float counts = adcSamplerFilteredCounts(pin);
+  if (counts <= 0.0f || counts >= HEALTH_ADC_MAX) return -1.0f;
+  float voltage = counts * (HEALTH_V_REF / HEALTH_ADC_MAX);
+  return (HEALTH_V_REF * HEALTH_RL) / voltage - HEALTH_RL;
+}
+
+/** Stored (untrimmed) R0 — the yardstick drift is measured against */
+static float storedR0(int channel) {
+  return calibrationR0(channel) / calibrationDriftTrim(channel);
+}
+
+static float channelDrift(int channel) {
+  float r0 = storedR0(channel);
+  if (updates[channel] == 0 || r0 <= 0.0f) return 0.0f;
+  return baselineRs[channel] / r0 - 1.0f;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void sensorHealthBegin(const int *pins, size_t numPins) {
+  channelCount = numPins < CALIBRATION_CHANNELS ? numPins
+                                                : CALIBRATION_CHANNELS;
+  for (size_t i = 0; i < channelCount; i++) {
+    channelPins[i] = pins[i];
+    baselineRs[i] = 0.0f;
+    updates[i] = 0;
+  }
+  Serial.println("✅ Sensor-health engine armed (baseline tracks clean air)");
+}
+
+void sensorHealthUpdate(RiskState risk) {
+  // Any anomaly means the air is not clean: the baseline must not move
+  if (risk != RISK_NORMAL) return;
+
+  for (size_t i = 0; i < channelCount; i++) {
+    float rs = filteredRs(channelPins[i]);
+    if (rs <= 0.0f) continue;
+
+    if (updates[i] == 0) {
+      baselineRs[i] = rs;
+    } else {
+      baselineRs[i] += SENSOR_HEALTH_ALPHA * (rs - baselineRs[i]);
+    }
+    updates[i]++;
+
+    // Bounded correction once warmed up: pull the effective R0 toward
+    // the observed clean-air baseline. calibrationSetDriftTrim clamps
+    // to ±CALIBRATION_MAX_TRIM — past that only recalibration helps.
+    if (updates[i] >= SENSOR_HEALTH_WARMUP) {
+      float r0 = storedR0((int)i);
+      if (r0 > 0.0f) {
+        calibrationSetDriftTrim((int)i, baselineRs[i] / r0);
+      }
+    }
+  }
+}
+
+SensorHealthReport sensorHealthReport() {
+  SensorHealthReport report = {};
+  for (size_t i = 0; i < channelCount; i++) {
+    float drift = channelDrift((int)i);
+    report.driftPct[i] = (int16_t)(drift * 10000.0f);
+    report.score[i] = sensorHealthScore((int)i);
+    if (fabsf(drift) >= SENSOR_HEALTH_RECAL_DRIFT) {
+      report.recalFlags |= (uint8_t)(1u << i);
+    }
+    if (calibrationDriftTrim((int)i) != 1.0f) {
+      report.trimFlags |= (uint8_t)(1u << i);
+    }
+  }
+  return report;
+}
+
+uint8_t sensorHealthScore(int channel) {
+  if (channel < 0 || channel >= (int)channelCount ||
+      updates[channel] < SENSOR_HEALTH_WARMUP) {
+    return 100;
+  }
+  float mag = fabsf(channelDrift(channel));
+  if (mag >= SENSOR_HEALTH_SCORE_FLOOR) return 0;
+  return (uint8_t)(100.0f * (1.0f - mag / SENSOR_HEALTH_SCORE_FLOOR));
+}
@@ -0,0 +1,80 @@
+/**
+ * GasGuard - Sensor-Health & Drift Engine
+ *
+ * MQ elements age: their clean-air resistance walks away from the R0
+ * captured at calibration, and a drifted sensor either floods the
+ * backend with false LOW_ANOMALY readings or goes blind. This engine
+ * watches the long-horizon baseline per channel — a slow EWMA of
+ * clean-air Rs, updated only while the classifier reads NORMAL so gas
+ * events never contaminate it — and compares it against the stored R0.
+ *
+ * Three outputs per channel:
+ *
+ *   drift    baseline Rs relative to stored R0, signed
+ *   score    100 at zero drift, 0 at SENSOR_HEALTH_SCORE_FLOOR drift
+ *   trim     bounded correction applied through calibrationSetDriftTrim
+ *            (±CALIBRATION_MAX_TRIM) once the EWMA has warmed up, so
+ *            gradual aging keeps the NORMAL band tight and the anomaly
+ *            gate keeps suppressing — the cheap-uplink property rides
+ *            on this
+ *
+ * Drift past the trim bound cannot be corrected in software; the
+ * channel is flagged for recalibration, and the flags ride the
+ * quiet-period heartbeat so the fleet dashboard sees aging sensors
+ * before operators do. The trim itself is RAM-only: a reboot restarts
+ * from the true calibration, nothing self-reinforces across power
+ * cycles.
+ */
+
+#ifndef GASGUARD_SENSOR_HEALTH_H
+#define GASGUARD_SENSOR_HEALTH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "risk_classifier.h"
+#include "calibration_store.h"
+
+// EWMA weight per NORMAL update. At one update per 5 s NORMAL cadence
+// this is a time constant of roughly half an hour — slow enough that a
+// missed leak cannot drag the baseline, fast enough to track aging.
+#define SENSOR_HEALTH_ALPHA        0.0025f
+
+// Updates before the baseline is trusted (trim stays 1.0 until then)
+#define SENSOR_HEALTH_WARMUP       256
+
+// Drift beyond the trim bound flags the channel for recalibration
+#define SENSOR_HEALTH_RECAL_DRIFT  (CALIBRATION_MAX_TRIM * 1.5f)
+
+// Drift at which the health score reaches 0
+#define SENSOR_HEALTH_SCORE_FLOOR  0.5f
+
+// Heartbeat payload, published on the "health" event topic (16 bytes)
+struct SensorHealthReport {
+  int16_t driftPct[CALIBRATION_CHANNELS];  // drift in 0.01 % steps
+  uint8_t score[CALIBRATION_CHANNELS];     // 0..100
+  uint8_t recalFlags;                      // bit n: channel n needs recal
+  uint8_t trimFlags;                       // bit n: trim active on channel n
+  uint16_t reserved;
+};
+
+/**
+ * Bind the channel->pin mapping (scheduler order, same array as
+ * adcSamplerBegin). Call once from setup() after adcSamplerBegin().
+ */
+void sensorHealthBegin(const int *pins, size_t numPins);
+
+/**
+ * One engine step; call from the processing task with each classified
+ * snapshot. Only NORMAL cycles feed the baseline; the rest are a
+ * single compare. Applies the bounded trim as the baseline moves.
+ */
+void sensorHealthUpdate(RiskState risk);
+
+/** Snapshot of all four channels for the heartbeat. */
+SensorHealthReport sensorHealthReport();
+
+/** Health score 0..100 for one channel (100 while warming up). */
+uint8_t sensorHealthScore(int channel);
+
+#endif // GASGUARD_SENSOR_HEALTH_H
@@ -1,365 +1,498 @@
-/**
- * GasGuard - MQ Sensor PPM Converter
- *
- * Converts MQ sensor analog readings to PPM (parts per million) values.
- * Supports: MQ-4 (Methane), MQ-6 (LPG), MQ-7 (CO), MQ-136 (H2S)
- *
- * IMPORTANT: Sensors must be calibrated in clean air before use!
- */
-
-#include <Arduino.h>
-#include <math.h>
-
-// ============================================================================
-// SENSOR CONFIGURATION
-// ============================================================================
-
-// Analog pins for each sensor (adjust based on your wiring)
-#define MQ4_PIN   34   // Methane (CH4)
-#define MQ6_PIN   35   // LPG
-#define MQ7_PIN   32   // Carbon Monoxide (CO)
-#define MQ136_PIN 33   // Hydrogen Sulfide (H2S)
-
-// ADC Configuration
-#define ADC_BITS      12        // ESP32 has 12-bit ADC (0-4095)
-#define ADC_MAX       4095.0
-#define V_REF         3.3       // ESP32 reference voltage
-
-// Load Resistance (RL) - typically 10kΩ for MQ sensors
-#define RL_VALUE      10.0      // in kΩ
-
-// Sensor calibration values (R0 = sensor resistance in clean air)
-// MUST BE CALIBRATED! These are typical values, adjust for your sensors
-#define MQ4_R0        10.0      // MQ-4 R0 in kΩ
-#define MQ6_R0        10.0      // MQ-6 R0 in kΩ
-#define MQ7_R0        10.0      // MQ-7 R0 in kΩ
-#define MQ136_R0      10.0      // MQ-136 R0 in kΩ
-
-// Conversion curve parameters (from datasheets)
-// PPM = A * (Rs/R0)^B
-
-// MQ-4 (Methane)
-#define MQ4_A         1012.0
-#define MQ4_B         -2.786
-
-// MQ-6 (LPG)
-#define MQ6_A         1009.0
-#define MQ6_B         -2.35
-
-// MQ-7 (Carbon Monoxide)
-#define MQ7_A         99.042
-#define MQ7_B         -1.518
-
-// MQ-136 (Hydrogen Sulfide)
-#define MQ136_A       44.947
-#define MQ136_B       -3.445
-
-// Sampling configuration
-#define NUM_SAMPLES   10        // Number of readings to average
-#define SAMPLE_DELAY  50        // Delay between samples (ms)
-
-// ============================================================================
-// HELPER FUNCTIONS
-// ============================================================================
-
-/**
- * Read analog value and convert to voltage
- */
-float readVoltage(int pin) {
-  int sum = 0;
-
-  // Take multiple samples and average
-  for (int i = 0; i < NUM_SAMPLES; i++) {
-    sum += analogRead(pin);
-    delay(SAMPLE_DELAY);
-  }
-
-  float avgValue = sum / (float)NUM_SAMPLES;
-  float voltage = avgValue * (V_REF / ADC_MAX);
-
-  return voltage;
-}
-
-/**
- * Calculate sensor resistance (Rs) from voltage
- */
-float calculateRs(float voltage) {
-  if (voltage <= 0.0 || voltage >= V_REF) {
-    return -1.0;  // Invalid reading
-  }
-
-  // Rs = [(Vc * RL) / Vout] - RL
-  float Rs = ((V_REF * RL_VALUE) / voltage) - RL_VALUE;
-
-  return Rs;
-}
-
-/**
- * Convert Rs/R0 ratio to PPM using power law
- * PPM = A * (Rs/R0)^B
- */
-float convertToPPM(float Rs, float R0, float A, float B) {
-  if (Rs <= 0 || R0 <= 0) {
-    return 0.0;  // Invalid
-  }
-
-  float ratio = Rs / R0;
-  float ppm = A * pow(ratio, B);
-
-  // Ensure non-negative result
-  if (ppm < 0) ppm = 0;
-
-  return ppm;
-}
-
-// ============================================================================
-// SENSOR READING FUNCTIONS
-// ============================================================================
-
-/**
- * Read MQ-4 sensor and return Methane concentration in PPM
- */
-float readMethanePPM() {
-  float voltage = readVoltage(MQ4_PIN);
-  float Rs = calculateRs(voltage);
-
-  if (Rs < 0) {
-    Serial.println("❌ MQ-4: Invalid reading");
-    return 0.0;
-  }
-
-  float ppm = convertToPPM(Rs, MQ4_R0, MQ4_A, MQ4_B);
-
-  Serial.printf("MQ-4 (CH4): V=%.2f, Rs=%.2f, PPM=%.2f\n", voltage, Rs, ppm);
-
-  return ppm;
-}
-
-/**
- * Read MQ-6 sensor and return LPG concentration in PPM
- */
-float readLPG_PPM() {
-  float voltage = readVoltage(MQ6_PIN);
-  float Rs = calculateRs(voltage);
-
-  if (Rs < 0) {
-    Serial.println("❌ MQ-6: Invalid reading");
-    return 0.0;
-  }
-
-  float ppm = convertToPPM(Rs, MQ6_R0, MQ6_A, MQ6_B);
-
-  Serial.printf("MQ-6 (LPG): V=%.2f, Rs=%.2f, PPM=%.2f\n", voltage, Rs, ppm);
-
-  return ppm;
-}
-
-/**
- * Read MQ-7 sensor and return Carbon Monoxide concentration in PPM
- */
-float readCO_PPM() {
-  float voltage = readVoltage(MQ7_PIN);
-  float Rs = calculateRs(voltage);
-
-  if (Rs < 0) {
-    Serial.println("❌ MQ-7: Invalid reading");
-    return 0.0;
-  }
-
-  float ppm = convertToPPM(Rs, MQ7_R0, MQ7_A, MQ7_B);
-
-  Serial.printf("MQ-7 (CO): V=%.2f, Rs=%.2f, PPM=%.2f\n", voltage, Rs, ppm);
-
-  return ppm;
-}
-
-/**
- * Read MQ-136 sensor and return Hydrogen Sulfide concentration in PPM
- */
-float readH2S_PPM() {
-  float voltage = readVoltage(MQ136_PIN);
-  float Rs = calculateRs(voltage);
-
-  if (Rs < 0) {
-    Serial.println("❌ MQ-136: Invalid reading");
-    return 0.0;
-  }
-
-  float ppm = convertToPPM(Rs, MQ136_R0, MQ136_A, MQ136_B);
-
-  Serial.printf("MQ-136 (H2S): V=%.2f, Rs=%.2f, PPM=%.2f\n", voltage, Rs, ppm);
-
-  return ppm;
-}
-
-// ============================================================================
-// CALIBRATION FUNCTION (CRITICAL!)
-// ============================================================================
-
-/**
- * Calibrate sensor in clean air
- * Run this function once before first use
- *
- * INSTRUCTIONS:
- * 1. Place sensors in clean air (outdoor or well-ventilated area)
- * 2. Wait 24-48 hours for sensor warm-up
- * 3. Run this calibration function
- * 4. Record the R0 values printed
- * 5. Update the R0 constants at the top of this file
- */
-void calibrateSensors() {
-  Serial.println("\n🔧 Starting Sensor Calibration...");
-  Serial.println("⚠️  Ensure sensors are in CLEAN AIR!");
-  Serial.println("⏳ Warming up for 60 seconds...\n");
-
-  delay(60000);  // 60 second warm-up
-
-  // MQ-4 Calibration
-  float v_mq4 = readVoltage(MQ4_PIN);
-  float r0_mq4 = calculateRs(v_mq4);
-  Serial.printf("MQ-4 R0 = %.2f kΩ\n", r0_mq4);
-
-  // MQ-6 Calibration
-  float v_mq6 = readVoltage(MQ6_PIN);
-  float r0_mq6 = calculateRs(v_mq6);
-  Serial.printf("MQ-6 R0 = %.2f kΩ\n", r0_mq6);
-
-  // MQ-7 Calibration
-  float v_mq7 = readVoltage(MQ7_PIN);
-  float r0_mq7 = calculateRs(v_mq7);
-  Serial.printf("MQ-7 R0 = %.2f kΩ\n", r0_mq7);
-
-  // MQ-136 Calibration
-  float v_mq136 = readVoltage(MQ136_PIN);
-  float r0_mq136 = calculateRs(v_mq136);
-  Serial.printf("MQ-136 R0 = %.2f kΩ\n", r0_mq136);
-
-  Serial.println("\n✅ Calibration Complete!");
-  Serial.println("📝 Copy these R0 values to the top of this file:");
-  Serial.printf("#define MQ4_R0    %.2f\n", r0_mq4);
-  Serial.printf("#define MQ6_R0    %.2f\n", r0_mq6);
-  Serial.printf("#define MQ7_R0    %.2f\n", r0_mq7);
-  Serial.printf("#define MQ136_R0  %.2f\n", r0_mq136);
-}
-
-// ============================================================================
-// MAIN SENSOR READING FUNCTION
-// ============================================================================
-
-/**
- * Read all sensors and return gas concentrations
- */
-struct GasReadings {
-  float methane;
-  float lpg;
-  float carbonMonoxide;
-  float hydrogenSulfide;
-  bool valid;
-};
-
-GasReadings readAllSensors() {
-  GasReadings readings;
-
-  readings.methane = readMethanePPM();
-  readings.lpg = readLPG_PPM();
-  readings.carbonMonoxide = readCO_PPM();
-  readings.hydrogenSulfide = readH2S_PPM();
-
-  // Check if readings are valid (all non-zero and within reasonable range)
-  readings.valid = (readings.methane >= 0 && readings.methane < 100000) &&
-                   (readings.lpg >= 0 && readings.lpg < 100000) &&
-                   (readings.carbonMonoxide >= 0 && readings.carbonMonoxide < 10000) &&
-                   (readings.hydrogenSulfide >= 0 && readings.hydrogenSulfide < 1000);
-
-  return readings;
-}
-
-// ============================================================================
-// ARDUINO SETUP & LOOP (Example)
-// ============================================================================
-
-void setup() {
-  Serial.begin(115200);
-  delay(1000);
-
-  Serial.println("🚀 GasGuard Sensor System Starting...");
-
-  // Configure ADC
-  analogReadResolution(ADC_BITS);
-  analogSetAttenuation(ADC_11db);  // Full range 0-3.3V
-
-  // Uncomment to run calibration (first time only)
-  // calibrateSensors();
-
-  Serial.println("✅ Sensors initialized");
-  Serial.println("📊 Reading gas concentrations...\n");
-}
-
-void loop() {
-  GasReadings readings = readAllSensors();
-
-  if (readings.valid) {
-    Serial.println("\n📊 Current Gas Levels:");
-    Serial.printf("  CH4:  %.2f ppm\n", readings.methane);
-    Serial.printf("  LPG:  %.2f ppm\n", readings.lpg);
-    Serial.printf("  CO:   %.2f ppm\n", readings.carbonMonoxide);
-    Serial.printf("  H2S:  %.2f ppm\n", readings.hydrogenSulfide);
-
-    // TODO: Send to backend via HTTP/MQTT
-    // sendToBackend(readings);
-  } else {
-    Serial.println("⚠️  Invalid sensor readings!");
-  }
-
-  delay(5000);  // Read every 5 seconds
-}
-
-// ============================================================================
-// NOTES & IMPORTANT INFORMATION
-// ============================================================================
-
-/*
- * CALIBRATION IS CRITICAL!
- * ========================
- * MQ sensors MUST be calibrated in clean air before use.
- * Without calibration, PPM values will be inaccurate.
- *
- * Calibration Process:
- * 1. Place sensors outdoors or in well-ventilated clean area
- * 2. Power on and wait 24-48 hours (pre-heating period)
- * 3. Run calibrateSensors() function
- * 4. Note the R0 values printed
- * 5. Update R0 constants in code
- *
- *
- * SENSOR WARM-UP TIME:
- * ====================
- * - MQ sensors require 24-48 hours of initial warm-up
- * - After power-on, wait at least 3 minutes before reading
- * - Keep sensors powered continuously for best accuracy
- *
- *
- * PPM CONVERSION ACCURACY:
- * ========================
- * - MQ sensors have ±10-20% accuracy (typical)
- * - Affected by temperature and humidity
- * - Cross-sensitivity to other gases exists
- * - Professional gas analyzers are more accurate but expensive
- *
- *
- * DATASHEET REFERENCES:
- * =====================
- * - MQ-4:  https://www.pololu.com/file/0J309/MQ4.pdf
- * - MQ-6:  https://www.pololu.com/file/0J310/MQ6.pdf
- * - MQ-7:  https://www.pololu.com/file/0J311/MQ7.pdf
- * - MQ-136: https://www.olimex.com/Products/Components/Sensors/MQ-136/resources/MQ-136.pdf
- *
- *
- * ALTERNATIVE: Use Pre-Calibrated Digital Sensors
- * ================================================
- * If you need higher accuracy, consider:
- * - SGP30 (TVOC and eCO2)
- * - CCS811 (eCO2 and TVOC)
- * - MH-Z19 (CO2 with UART output)
- * - Alphasense sensors (professional grade, expensive)
- */
+/**
+ * GasGuard - MQ Sensor PPM Converter
+ *
+ * Converts MQ sensor analog readings to PPM (parts per million) values.
+ * Supports: MQ-4 (Methane), MQ-6 (LPG), MQ-7 (CO), MQ-136 (H2S)
+ *
+ * IMPORTANT: Sensors must be calibrated in clean air before use!
+ */
+
+// Hot-path arithmetic: 1 = Q16.16 integer pipeline (see fixed_point.h),
+// 0 = original float pipeline. Enable on nodes where float math is the
+// bottleneck; results agree to well within sensor accuracy. Must sit
+// above the includes so the MQSensor<> template (mq_sensor.h) compiles
+// the selected Rs path.
+#define GASGUARD_FIXED_POINT  0
+
+#include <Arduino.h>
+#include <math.h>
+
+#include "adc_sampler.h"
+#include "sampling_scheduler.h"
+#include "fixed_point.h"
+#include "ppm_lut.h"
+#include "mq_sensor.h"
+#include "gas_readings.h"
+#include "firmware_tasks.h"
+#include "calibration_store.h"
+#include "mqtt_uplink.h"
+#include "flight_recorder.h"
+#include "mq7_heater.h"
+#include "deep_sleep.h"
+#include "espnow_relay.h"
+#include "static_arena.h"
+#include "ota_delta.h"
+#include "flash_spool.h"
+#include "vent_control.h"
+#include "sensor_health.h"
+
+// ============================================================================
+// SENSOR CONFIGURATION
+// ============================================================================
+
+// Analog pins for each sensor (adjust based on your wiring)
+#define MQ4_PIN   34   // Methane (CH4)
+#define MQ6_PIN   35   // LPG
+#define MQ7_PIN   32   // Carbon Monoxide (CO)
+#define MQ136_PIN 33   // Hydrogen Sulfide (H2S)
+
+// ADC Configuration
+#define ADC_BITS      12        // ESP32 has 12-bit ADC (0-4095)
+#define ADC_MAX       4095.0
+#define V_REF         3.3       // ESP32 reference voltage
+
+// Load Resistance (RL) - typically 10kΩ for MQ sensors
+#define RL_VALUE      10.0      // in kΩ
+
+// Sensor calibration values (R0 = sensor resistance in clean air)
+// MUST BE CALIBRATED! These are typical values, adjust for your sensors
+#define MQ4_R0        10.0      // MQ-4 R0 in kΩ
+#define MQ6_R0        10.0      // MQ-6 R0 in kΩ
+#define MQ7_R0        10.0      // MQ-7 R0 in kΩ
+#define MQ136_R0      10.0      // MQ-136 R0 in kΩ
+
+// Conversion curve parameters (from datasheets)
+// PPM = A * (Rs/R0)^B
+
+// MQ-4 (Methane)
+#define MQ4_A         1012.0
+#define MQ4_B         -2.786
+
+// MQ-6 (LPG)
+#define MQ6_A         1009.0
+#define MQ6_B         -2.35
+
+// MQ-7 (Carbon Monoxide)
+#define MQ7_A         99.042
+#define MQ7_B         -1.518
+
+// MQ-136 (Hydrogen Sulfide)
+#define MQ136_A       44.947
+#define MQ136_B       -3.445
+
+// Sampling configuration
+#define NUM_SAMPLES   10        // Number of readings to average
+#define SAMPLE_DELAY  50        // Delay between samples (ms)
+
+// MQTT uplink (requires Wi-Fi configured on the node image). Set to 1
+// and point at the zone broker to ship batched binary frames.
+#define GASGUARD_MQTT_ENABLED 0
+#define GASGUARD_MQTT_BROKER  "mqtt://192.168.1.10"
+#define GASGUARD_CLIENT_ID    "ZONE_A_01"
+
+// MQ-7 heater cycling (requires the heater MOSFET stage on
+// MQ7_HEATER_PIN — see mq7_heater.h). On boards with the heater tied
+// straight to 5V leave this 0; CO readings then use the live voltage
+// as before.
+#define GASGUARD_MQ7_CYCLING  0
+
+// Battery-node build: deep-sleep between sampling bursts, carrying the
+// filter/calibration/gate state in RTC memory (see deep_sleep.h).
+// Mains-powered nodes leave this 0 and run continuously.
+#define GASGUARD_DEEP_SLEEP   0
+
+// Zone mesh role: 0 = standalone (direct uplink), 1 = leaf (broadcast
+// to the zone gateway over ESP-NOW), 2 = gateway (aggregate the zone's
+// leaves and batch-upload). See espnow_relay.h.
+#define GASGUARD_ESPNOW_MODE  0
+#define GASGUARD_ESPNOW_NODE_ID 1
+
+// ============================================================================
+// SENSOR DEFINITIONS (traits consumed by the MQSensor<> template)
+// ============================================================================
+
+struct MQ4Sensor {
+  static constexpr int PIN = MQ4_PIN;
+  static constexpr int CHANNEL = SCHED_CH_MQ4;
+  static constexpr float R0 = MQ4_R0;
+  static constexpr double A = MQ4_A;
+  static constexpr double B = MQ4_B;
+  static constexpr const char *NAME = "MQ-4 (CH4)";
+};
+
+struct MQ6Sensor {
+  static constexpr int PIN = MQ6_PIN;
+  static constexpr int CHANNEL = SCHED_CH_MQ6;
+  static constexpr float R0 = MQ6_R0;
+  static constexpr double A = MQ6_A;
+  static constexpr double B = MQ6_B;
+  static constexpr const char *NAME = "MQ-6 (LPG)";
+};
+
+struct MQ7Sensor {
+  static constexpr int PIN = MQ7_PIN;
+  static constexpr int CHANNEL = SCHED_CH_MQ7;
+  static constexpr float R0 = MQ7_R0;
+  static constexpr double A = MQ7_A;
+  static constexpr double B = MQ7_B;
+  static constexpr const char *NAME = "MQ-7 (CO)";
+};
+
+struct MQ136Sensor {
+  static constexpr int PIN = MQ136_PIN;
+  static constexpr int CHANNEL = SCHED_CH_MQ136;
+  static constexpr float R0 = MQ136_R0;
+  static constexpr double A = MQ136_A;
+  static constexpr double B = MQ136_B;
+  static constexpr const char *NAME = "MQ-136 (H2S)";
+};
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Read analog value and convert to voltage
+ *
+ * Non-blocking: returns the streaming filtered estimate maintained
+ * per-sample by the DMA engine (EWMA with glitch rejection, see
+ * stream_filter.h) — O(1) with no accumulation window. Falls back to
+ * the old blocking sample-and-delay loop only if the DMA engine has
+ * not produced data yet (e.g. first milliseconds after boot).
+ */
+float readVoltage(int pin) {
+  float voltage = adcSamplerFilteredVoltage(pin);
+  if (voltage >= 0) {
+    return voltage;
+  }
+
+  // Fallback: blocking sample-and-average (pre-DMA behaviour)
+  int sum = 0;
+  for (int i = 0; i < NUM_SAMPLES; i++) {
+    sum += analogRead(pin);
+    delay(SAMPLE_DELAY);
+  }
+
+  float avgValue = sum / (float)NUM_SAMPLES;
+  return avgValue * (V_REF / ADC_MAX);
+}
+
+/**
+ * Calculate sensor resistance (Rs) from voltage
+ *
+ * With GASGUARD_FIXED_POINT the divide runs in Q16.16 integer math
+ * (the ADC-count form of the formula needs no float at all); the float
+ * conversions here exist only because this entry point takes volts.
+ * Callers that already hold raw counts should use q16RsFromCounts()
+ * directly and skip the boundary conversion.
+ */
+float calculateRs(float voltage) {
+  if (voltage <= 0.0 || voltage >= V_REF) {
+    return -1.0;  // Invalid reading
+  }
+
+#if GASGUARD_FIXED_POINT
+  int32_t counts = (int32_t)(voltage * (ADC_MAX / V_REF) + 0.5f);
+  q16_t rs = q16RsFromCounts(counts);
+  if (rs < 0) return -1.0;
+  return q16ToFloat(rs);
+#else
+  // Rs = [(Vc * RL) / Vout] - RL
+  float Rs = ((V_REF * RL_VALUE) / voltage) - RL_VALUE;
+
+  return Rs;
+#endif
+}
+
+/**
+ * Convert Rs/R0 ratio to PPM using power law
+ * PPM = A * (Rs/R0)^B
+ */
+float convertToPPM(float Rs, float R0, float A, float B) {
+  if (Rs <= 0 || R0 <= 0) {
+    return 0.0;  // Invalid
+  }
+
+  float ratio = Rs / R0;
+  float ppm = A * pow(ratio, B);
+
+  // Ensure non-negative result
+  if (ppm < 0) ppm = 0;
+
+  return ppm;
+}
+
+// ============================================================================
+// SENSOR READING FUNCTIONS
+// ============================================================================
+
+// The per-sensor read logic lives in the MQSensor<> template (see
+// mq_sensor.h); these wrappers keep the historical API. Each
+// specialization is fully constant-folded and carries its own
+// compile-time PPM lookup table.
+
+/**
+ * Convert an MQ-4 voltage snapshot to Methane concentration in PPM
+ */
+float readMethanePPM(float voltage) {
+  return MQSensor<MQ4Sensor>::readPPM(voltage);
+}
+
+/**
+ * Convert an MQ-6 voltage snapshot to LPG concentration in PPM
+ */
+float readLPG_PPM(float voltage) {
+  return MQSensor<MQ6Sensor>::readPPM(voltage);
+}
+
+/**
+ * Convert an MQ-7 voltage snapshot to Carbon Monoxide concentration in PPM
+ */
+float readCO_PPM(float voltage) {
+  return MQSensor<MQ7Sensor>::readPPM(voltage);
+}
+
+/**
+ * Convert an MQ-136 voltage snapshot to Hydrogen Sulfide concentration in PPM
+ */
+float readH2S_PPM(float voltage) {
+  return MQSensor<MQ136Sensor>::readPPM(voltage);
+}
+
+// ============================================================================
+// CALIBRATION FUNCTION (CRITICAL!)
+// ============================================================================
+
+/**
+ * Calibrate sensors in clean air and persist R0 to NVS
+ *
+ * INSTRUCTIONS:
+ * 1. Place sensors in clean air (outdoor or well-ventilated area)
+ * 2. Sensors must already be warmed up (24-48 hours after first
+ *    power-on; keep them powered continuously)
+ * 3. Trigger this function (serial command or OTA request)
+ *
+ * The measured R0 values are written to the persistent calibration
+ * store (see calibration_store.h) and take effect immediately — no
+ * recompile, no reflash, no blocking warm-up delay: the streaming
+ * filters have been averaging clean-air readings continuously since
+ * boot, so the current filtered Rs IS the calibration value.
+ */
+void calibrateSensors() {
+  Serial.println("\n🔧 Starting Sensor Calibration...");
+  Serial.println("⚠️  Ensure sensors are in CLEAN AIR and warmed up!");
+
+  const int pins[CALIBRATION_CHANNELS] = { MQ4_PIN, MQ6_PIN, MQ7_PIN, MQ136_PIN };
+  const char *names[CALIBRATION_CHANNELS] = { "MQ-4", "MQ-6", "MQ-7", "MQ-136" };
+
+  float r0[CALIBRATION_CHANNELS];
+  for (int ch = 0; ch < CALIBRATION_CHANNELS; ch++) {
+    float voltage = readVoltage(pins[ch]);
+    r0[ch] = calculateRs(voltage);
+    Serial.printf("%s R0 = %.2f kΩ\n", names[ch], r0[ch]);
+
+    if (r0[ch] <= 0) {
+      Serial.printf("❌ %s: invalid clean-air reading, calibration aborted\n",
+                    names[ch]);
+      return;
+    }
+  }
+
+  if (calibrationSave(r0)) {
+    Serial.println("\n✅ Calibration stored to NVS and active");
+  } else {
+    Serial.println("\n⚠️  Calibration active but NVS write failed");
+  }
+}
+
+// ============================================================================
+// MAIN SENSOR READING FUNCTION
+// ============================================================================
+
+/**
+ * Read all sensors and return gas concentrations
+ * (GasReadings struct lives in gas_readings.h, shared with the tasks
+ * and transport layers)
+ */
+GasReadings readAllSensors() {
+  GasReadings readings;
+
+  // One coherent snapshot of all four channels in a single sampling
+  // window (see sampling_scheduler.h), instead of four sequential windows
+  float voltages[SCHED_NUM_CHANNELS];
+  samplingSchedulerSnapshot(voltages);
+
+#if GASGUARD_MQ7_CYCLING
+  // The MQ-7 is only meaningful in its heater measurement window;
+  // substitute the freshest phase-valid voltage latched by the heater
+  // scheduler. Falls through to the live voltage until the first
+  // window completes after boot.
+  float mq7Voltage = mq7PhaseAlignedVoltage();
+  if (mq7Voltage >= 0) {
+    voltages[SCHED_CH_MQ7] = mq7Voltage;
+  }
+#endif
+
+  readings.methane = readMethanePPM(voltages[SCHED_CH_MQ4]);
+  readings.lpg = readLPG_PPM(voltages[SCHED_CH_MQ6]);
+  readings.carbonMonoxide = readCO_PPM(voltages[SCHED_CH_MQ7]);
+  readings.hydrogenSulfide = readH2S_PPM(voltages[SCHED_CH_MQ136]);
+
+  // Check if readings are valid (all non-zero and within reasonable range)
+  readings.valid = (readings.methane >= 0 && readings.methane < 100000) &&
+                   (readings.lpg >= 0 && readings.lpg < 100000) &&
+                   (readings.carbonMonoxide >= 0 && readings.carbonMonoxide < 10000) &&
+                   (readings.hydrogenSulfide >= 0 && readings.hydrogenSulfide < 1000);
+
+  return readings;
+}
+
+// ============================================================================
+// ARDUINO SETUP & LOOP (Example)
+// ============================================================================
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+
+  Serial.println("🚀 GasGuard Sensor System Starting...");
+
+  // Configure ADC
+  analogReadResolution(ADC_BITS);
+  analogSetAttenuation(ADC_11db);  // Full range 0-3.3V
+
+  // Start continuous DMA sampling on all four sensor pins
+  // (pin order must match the SCHED_CH_* channel indices)
+  const int sensorPins[] = { MQ4_PIN, MQ6_PIN, MQ7_PIN, MQ136_PIN };
+  adcSamplerBegin(sensorPins, 4);
+  samplingSchedulerBegin(sensorPins, 4);
+
+  // High-rate raw-count history for incident forensics (frozen on ALERT)
+  flightRecorderBegin(sensorPins, 4);
+
+  // Offline spool: readings survive Wi-Fi outages on the 'spool' flash
+  // partition and are drained after reconnect (see flash_spool.h)
+  flashSpoolBegin();
+
+  // Load per-device R0 from NVS (milliseconds); compile-time values
+  // are only the fallback for never-calibrated nodes
+  const float defaultR0[CALIBRATION_CHANNELS] = { MQ4_R0, MQ6_R0, MQ7_R0, MQ136_R0 };
+  calibrationBegin(defaultR0);
+
+  // Long-horizon drift tracking against the stored R0; bounded trim
+  // keeps the NORMAL band tight as the elements age (see sensor_health.h)
+  sensorHealthBegin(sensorPins, 4);
+
+#if GASGUARD_DEEP_SLEEP
+  // Warm wake: re-seed the streaming filters, R0 cache and anomaly
+  // gate window from RTC memory so the first snapshot is already valid
+  deepSleepBegin(sensorPins, 4);
+#endif
+
+  // Run calibrateSensors() on demand (clean air, warmed-up sensors);
+  // results persist to NVS and apply immediately
+
+#if GASGUARD_MQ7_CYCLING
+  // Datasheet 60s/90s heater cycle; CO is sampled phase-aligned
+  mq7HeaterBegin(MQ7_PIN);
+#endif
+
+#if GASGUARD_MQTT_ENABLED
+  // Persistent session; frames queue while the link is down
+  mqttUplinkBegin(GASGUARD_MQTT_BROKER, GASGUARD_CLIENT_ID);
+
+  // Delta patches arrive on gasguard/<id>/ota (see ota_delta.h); the
+  // pipeline coming up below is the health check that confirms a
+  // freshly updated image and cancels the bootloader rollback
+  otaDeltaBindDownlink();
+  otaDeltaConfirmBoot();
+
+  // Ventilation mode commands (OFF/AUTO/FORCED) arrive on
+  // gasguard/<id>/vent; actuation itself is local (see vent_control.h)
+  ventControlBindDownlink();
+#endif
+
+  Serial.println("✅ Sensors initialized");
+  Serial.println("📊 Reading gas concentrations...\n");
+
+  // Hand the main flow to the pinned FreeRTOS tasks: sampling on
+  // core 0, processing/transport on core 1 (see firmware_tasks.h)
+  firmwareTasksBegin();
+
+#if GASGUARD_ESPNOW_MODE == 1
+  // Leaf: snapshots relay to the zone gateway; no backend connection
+  espnowRelayBeginLeaf(GASGUARD_ESPNOW_NODE_ID);
+#elif GASGUARD_ESPNOW_MODE == 2
+  // Gateway: aggregate the zone's leaves onto this node's uplink
+  espnowRelayBeginGateway();
+#endif
+
+  // Everything is up: the steady state must not allocate from here on
+  // (see static_arena.h — instrumented builds abort on violation)
+  arenaSealHeap();
+}
+
+void loop() {
+#if GASGUARD_DEEP_SLEEP
+  // Burst complete once the processing task has seen a valid snapshot
+  // and the awake budget is spent; state is captured to RTC on the way
+  // down. deepSleepEnter() does not return.
+  if (millis() >= DEEP_SLEEP_AWAKE_MS && firmwareTasksLatest().valid) {
+    deepSleepEnter();
+  }
+  vTaskDelay(pdMS_TO_TICKS(100));
+#else
+  // All work happens in the pinned tasks; keep the Arduino loop idle
+  vTaskDelay(pdMS_TO_TICKS(1000));
+#endif
+}
+
+// ============================================================================
+// NOTES & IMPORTANT INFORMATION
+// ============================================================================
+
+/*
+ * CALIBRATION IS CRITICAL!
+ * ========================
+ * MQ sensors MUST be calibrated in clean air before use.
+ * Without calibration, PPM values will be inaccurate.
+ *
+ * Calibration Process:
+ * 1. Place sensors outdoors or in well-ventilated clean area
+ * 2. Power on and wait 24-48 hours (pre-heating period)
+ * 3. Run calibrateSensors() function
+ * 4. Note the R0 values printed
+ * 5. Update R0 constants in code
+ *
+ *
+ * SENSOR WARM-UP TIME:
+ * ====================
+ * - MQ sensors require 24-48 hours of initial warm-up
+ * - After power-on, wait at least 3 minutes before reading
+ * - Keep sensors powered continuously for best accuracy
+ *
+ *
+ * PPM CONVERSION ACCURACY:
+ * ========================
+ * - MQ sensors have ±10-20% accuracy (typical)
+ * - Affected by temperature and humidity
+ * - Cross-sensitivity to other gases exists
+ * - Professional gas analyzers are more accurate but expensive
+ *
+ *
+ * DATASHEET REFERENCES:
+ * =====================
+ * - MQ-4:  https://www.pololu.com/file/0J309/MQ4.pdf
+ * - MQ-6:  https://www.pololu.com/file/0J310/MQ6.pdf
+ * - MQ-7:  https://www.pololu.com/file/0J311/MQ7.pdf
+ * - MQ-136: https://www.olimex.com/Products/Components/Sensors/MQ-136/resources/MQ-136.pdf
+ *
+ *
+ * ALTERNATIVE: Use Pre-Calibrated Digital Sensors
+ * ================================================
+ * If you need higher accuracy, consider:
+ * - SGP30 (TVOC and eCO2)
+ * - CCS811 (eCO2 and TVOC)
+ * - MH-Z19 (CO2 with UART output)
+ * - Alphasense sensors (professional grade, expensive)
+ */
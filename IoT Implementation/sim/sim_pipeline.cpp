@@ -0,0 +1,271 @@
+/**
+ * GasGuard - Deterministic Host Simulation Harness
+ *
+ * Runs the production pipeline — StreamFilter, batch conversion,
+ * classifyReadings, the adaptive-rate controller, the anomaly gate and
+ * the uplink encoder, all included straight from the parent directory
+ * via gasguard_core.h — against injected clock, ADC and transport, so
+ * tuning work iterates on a desktop in seconds instead of a
+ * flash-and-watch-serial cycle per experiment.
+ *
+ * Injection points (see gasguard_core.h for the core contract):
+ *   clock      simulated milliseconds, advanced by exactly the period
+ *              the adaptive controller returns — virtual days of node
+ *              time pass in wall-clock seconds
+ *   ADC        a SimSource callback: the Datasets-derived trace
+ *              (bench/trace_data.h) or the seeded synthetic generator
+ *              with injected leak events
+ *   transport  a SimTransport callback counting frames/bytes and
+ *              folding every emitted byte into a CRC32
+ *
+ * Everything is deterministic: no wall clock, no threads, a fixed RNG
+ * seed. The harness runs each scenario twice and asserts the transport
+ * CRCs match — if a change makes the pipeline nondeterministic, this
+ * is where it fails first.
+ *
+ *   make && ./sim_pipeline
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+#include "../gasguard_core.h"
+#include "../bench/trace_data.h"
+
+// Constants mirroring sensor_ppm_converter.cpp / espnow_relay.cpp
+// (channel order SCHED_CH_*: MQ-4, MQ-6, MQ-7, MQ-136)
+static constexpr double CURVE_A[4] = { 1012.0, 1009.0, 99.042, 44.947 };
+static constexpr double CURVE_B[4] = { -2.786, -2.35, -1.518, -3.445 };
+#define SIM_R0 10.0f
+
+// ============================================================================
+// INJECTED INTERFACES
+// ============================================================================
+
+/** Raw counts for all four channels at one tick */
+struct SimSource {
+  void (*read)(void *ctx, uint32_t tick, uint16_t counts[4]);
+  void *ctx;
+};
+
+/** Receives every encoded uplink frame the pipeline emits */
+struct SimTransport {
+  void (*send)(void *ctx, const uint8_t *frame, size_t len);
+  void *ctx;
+};
+
+// ============================================================================
+// SOURCES
+// ============================================================================
+
+/** Dataset trace on every channel, small fixed per-channel offset so
+ *  the four filters see distinct streams (as on real hardware) */
+static void traceRead(void *ctx, uint32_t tick, uint16_t counts[4]) {
+  (void)ctx;
+  uint16_t base = TRACE_COUNTS[tick % TRACE_LENGTH];
+  for (int ch = 0; ch < 4; ch++) {
+    counts[ch] = (uint16_t)(base + ch * 7);
+  }
+}
+
+/** xorshift32 — tiny, seedable, identical on every platform */
+struct SynthState {
+  uint32_t rng;
+  uint32_t next() {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+  }
+};
+
+/** Clean-air baseline with noise, plus a leak ramp every 100k ticks —
+ *  exercises escalation, gating and de-escalation end to end */
+static void synthRead(void *ctx, uint32_t tick, uint16_t counts[4]) {
+  SynthState *s = (SynthState *)ctx;
+  uint32_t phase = tick % 100000;
+
+  for (int ch = 0; ch < 4; ch++) {
+    int32_t c = 700 + (int32_t)(s->next() % 21) - 10;  // baseline ±10
+    if (phase >= 50000 && phase < 52000) {
+      // Leak: counts sag as Rs drops (gas present)
+      uint32_t depth = phase < 51000 ? phase - 50000 : 52000 - phase;
+      c += 2 * (int32_t)depth;
+    }
+    counts[ch] = (uint16_t)c;
+  }
+}
+
+// ============================================================================
+// TRANSPORT
+// ============================================================================
+
+struct CountingTransport {
+  uint32_t frames = 0;
+  uint64_t bytes = 0;
+  uint32_t crc = 0;
+};
+
+static void countingSend(void *ctx, const uint8_t *frame, size_t len) {
+  CountingTransport *t = (CountingTransport *)ctx;
+  t->frames++;
+  t->bytes += len;
+  t->crc = ggCrc32Update(t->crc, frame, len);
+}
+
+// ============================================================================
+// PIPELINE
+// ============================================================================
+
+struct SimStats {
+  uint64_t ticks = 0;
+  uint64_t simMs = 0;           // virtual node time covered
+  uint64_t suppressed = 0;
+  uint64_t riskCount[6] = {};
+  CountingTransport transport;
+  double wallSeconds = 0;
+};
+
+/**
+ * The processing loop, verbatim logic from samplingTask/processingTask
+ * in firmware_tasks.cpp, minus the hardware at either end
+ */
+static SimStats runPipeline(SimSource source, uint64_t ticks) {
+  SimStats stats;
+  SimTransport transport = { countingSend, &stats.transport };
+
+  static const PpmLut luts[4] = {
+    ppmLutBuild(CURVE_A[0], CURVE_B[0]), ppmLutBuild(CURVE_A[1], CURVE_B[1]),
+    ppmLutBuild(CURVE_A[2], CURVE_B[2]), ppmLutBuild(CURVE_A[3], CURVE_B[3]),
+  };
+  const float r0[4] = { SIM_R0, SIM_R0, SIM_R0, SIM_R0 };
+
+  StreamFilter filters[4];
+  AnomalyGate gate;
+  UplinkEncoder encoder;
+  encoder.reset();
+
+  uint32_t simMs = 0;
+  auto started = std::chrono::steady_clock::now();
+
+  for (uint64_t tick = 0; tick < ticks; tick++) {
+    uint16_t raw[4];
+    source.read(source.ctx, (uint32_t)tick, raw);
+
+    // Acquire: per-channel EWMA filter, then the batch kernel (n=1 is
+    // the scalar production path)
+    uint16_t filtered[4];
+    for (int ch = 0; ch < 4; ch++) {
+      filters[ch].update((float)raw[ch]);
+      filtered[ch] = (uint16_t)filters[ch].value();
+    }
+
+    float ppm[4][1];
+    float *ppmOut[4] = { ppm[0], ppm[1], ppm[2], ppm[3] };
+    BatchCountsFrame frame = {
+      { &filtered[0], &filtered[1], &filtered[2], &filtered[3] }, 1
+    };
+    batchConvertFrame(frame, luts, r0, ppmOut);
+
+    GasReadings readings = { ppm[0][0], ppm[1][0], ppm[2][0], ppm[3][0],
+                             true };
+
+    // Classify, steer the cadence, gate, encode — production code
+    RiskState risk = classifyReadings(readings);
+    stats.riskCount[risk]++;
+
+    uint32_t periodMs = adaptiveSamplerUpdate(risk, simMs);
+
+    AnomalyGateDecision decision = gate.update(readings, risk, simMs);
+    bool frameReady = false;
+    if (decision != GATE_SUPPRESS) {
+      frameReady = encoder.addSnapshot(readings);
+    } else {
+      stats.suppressed++;
+    }
+    if (decision == GATE_HEARTBEAT && encoder.snapshots() > 0) {
+      frameReady = true;
+    }
+
+    if (frameReady) {
+      transport.send(transport.ctx, encoder.data(), encoder.size());
+      encoder.reset();
+    }
+
+    simMs += periodMs;
+  }
+
+  auto elapsed = std::chrono::steady_clock::now() - started;
+  stats.wallSeconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(elapsed)
+          .count();
+  stats.ticks = ticks;
+  stats.simMs = simMs;
+  return stats;
+}
+
+/** Force the adaptive controller back to the idle profile so repeated
+ *  scenarios start from identical state (it has no reset API — on the
+ *  device it never needs one) */
+static void settleAdaptiveSampler() {
+  adaptiveSamplerUpdate(RISK_NORMAL, 0);
+  adaptiveSamplerUpdate(RISK_NORMAL, ADAPTIVE_HOLD_MS + 1);
+}
+
+// ============================================================================
+// SCENARIOS
+// ============================================================================
+
+static void report(const char *name, const SimStats &s) {
+  printf("%-10s %10llu samples in %6.2f s  (%8.0f samples/s, %.1f sim-days)\n",
+         name, (unsigned long long)s.ticks, s.wallSeconds,
+         (double)s.ticks / s.wallSeconds,
+         (double)s.simMs / 86400000.0);
+  printf("           frames %u (%llu B), suppressed %.1f%%, risk N/L/U/A/W/C ="
+         " %llu/%llu/%llu/%llu/%llu/%llu\n",
+         s.transport.frames, (unsigned long long)s.transport.bytes,
+         100.0 * (double)s.suppressed / (double)s.ticks,
+         (unsigned long long)s.riskCount[0], (unsigned long long)s.riskCount[1],
+         (unsigned long long)s.riskCount[2], (unsigned long long)s.riskCount[3],
+         (unsigned long long)s.riskCount[4],
+         (unsigned long long)s.riskCount[5]);
+}
+
+int main() {
+  printf("GasGuard pipeline simulation (production code, injected I/O)\n\n");
+
+  // Dataset-derived trace, looped
+  SimSource traceSource = { traceRead, NULL };
+  settleAdaptiveSampler();
+  SimStats trace1 = runPipeline(traceSource, 2000000);
+  settleAdaptiveSampler();
+  SimStats trace2 = runPipeline(traceSource, 2000000);
+  report("trace", trace1);
+
+  // Synthetic clean air with periodic leak ramps
+  SynthState synth1 = { 0x4747u };
+  SimSource synthSource = { synthRead, &synth1 };
+  settleAdaptiveSampler();
+  SimStats syn1 = runPipeline(synthSource, 5000000);
+  SynthState synth2 = { 0x4747u };
+  synthSource.ctx = &synth2;
+  settleAdaptiveSampler();
+  SimStats syn2 = runPipeline(synthSource, 5000000);
+  report("synthetic", syn1);
+
+  // Determinism gate: same scenario, same bytes, bit for bit
+  printf("\ntrace CRC %08x/%08x, synthetic CRC %08x/%08x\n",
+         trace1.transport.crc, trace2.transport.crc,
+         syn1.transport.crc, syn2.transport.crc);
+  if (trace1.transport.crc != trace2.transport.crc ||
+      trace1.transport.frames != trace2.transport.frames ||
+      syn1.transport.crc != syn2.transport.crc ||
+      syn1.transport.frames != syn2.transport.frames) {
+    printf("❌ NONDETERMINISTIC: repeated runs diverged\n");
+    return 1;
+  }
+  printf("✅ deterministic: repeated runs byte-identical\n");
+  return 0;
+}
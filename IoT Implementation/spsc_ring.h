@@ -0,0 +1,99 @@
+/**
+ * GasGuard - Lock-Free SPSC Snapshot Ring
+ *
+ * Fixed-capacity single-producer/single-consumer ring for GasReadings
+ * (or any trivially-copyable struct). No mutexes, no heap — just a
+ * statically-sized slot array and one atomic sequence counter.
+ *
+ * Semantics are overwrite-oldest: the producer publishes
+ * unconditionally and never blocks or waits on the consumer, so the
+ * sampling task can keep its 10 Hz cadence even if the consumer stalls
+ * for seconds. A stalled consumer simply loses the oldest snapshots
+ * (counted in dropped()).
+ *
+ * The consumer detects a slot being overwritten mid-copy by re-checking
+ * the write sequence after the copy (seqlock style) and skipping
+ * forward — a torn read is never returned.
+ */
+
+#ifndef GASGUARD_SPSC_RING_H
+#define GASGUARD_SPSC_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+template <typename T, size_t N>
+class SpscRing {
+  static_assert((N & (N - 1)) == 0, "ring capacity must be a power of two");
+
+ public:
+  /**
+   * Producer side. Copies the item into the next slot and publishes it.
+   * Never blocks, never fails, O(1).
+   */
+  void publish(const T &item) {
+    uint32_t seq = writeSeq.load(std::memory_order_relaxed);
+    slots[seq & (N - 1)] = item;
+    // Release: the slot contents are visible before the new sequence
+    writeSeq.store(seq + 1, std::memory_order_release);
+  }
+
+  /**
+   * Consumer side. Pops the oldest unconsumed snapshot into `out`.
+   * Returns false if the ring is empty. Never blocks the producer.
+   */
+  bool consume(T &out) {
+    for (;;) {
+      uint32_t wr = writeSeq.load(std::memory_order_acquire);
+      if (readSeq == wr) {
+        return false;  // Empty
+      }
+
+      // If the producer lapped us, resync past the oldest surviving
+      // slot: at wr - readSeq == N the slot at readSeq is exactly the
+      // one the producer overwrites next (item wr lands in the same
+      // slot while writeSeq still reads wr), so it is never readable
+      if (wr - readSeq >= N) {
+        droppedCount += (wr - readSeq) - (N - 1);
+        readSeq = wr - N + 1;
+      }
+
+      uint32_t seq = readSeq;
+      out = slots[seq & (N - 1)];
+
+      // Re-check: if the producer overwrote this slot while we copied,
+      // the copy may be torn — skip forward and retry. Strictly < N:
+      // at distance N the producer may already be mid-store into this
+      // slot before writeSeq advances.
+      if (writeSeq.load(std::memory_order_acquire) - seq < N) {
+        readSeq = seq + 1;
+        return true;
+      }
+    }
+  }
+
+  /**
+   * Unconsumed snapshots currently in the ring (consumer side). Caps
+   * at N - 1: when fully lapped the oldest slot is the producer's next
+   * target and consume() will never return it.
+   */
+  size_t size() const {
+    uint32_t wr = writeSeq.load(std::memory_order_acquire);
+    uint32_t pending = wr - readSeq;
+    return pending > N - 1 ? N - 1 : pending;
+  }
+
+  /**
+   * Snapshots lost to consumer stalls since boot
+   */
+  uint32_t dropped() const { return droppedCount; }
+
+ private:
+  T slots[N];
+  std::atomic<uint32_t> writeSeq{0};
+  uint32_t readSeq = 0;        // consumer-private, no atomics needed
+  uint32_t droppedCount = 0;   // consumer-private
+};
+
+#endif // GASGUARD_SPSC_RING_H
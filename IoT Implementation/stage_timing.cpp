@@ -0,0 +1,95 @@
+/**
+ * GasGuard - Pipeline Stage Timing (implementation)
+ *
+ * CCOUNT wraps every ~17.9 s at 240 MHz; stage durations are tens of
+ * milliseconds at worst, so unsigned subtraction handles the wrap and
+ * a reading that looks longer than a second is discarded as a wrap
+ * artifact rather than poisoning the histogram tail.
+ */
+
+#include <Arduino.h>
+#include <esp_task_wdt.h>
+
+#include "stage_timing.h"
+#include "gg_log.h"
+
+// Sanity ceiling: longer than this is a counter artifact, not a stage
+#define STAGE_MAX_CREDIBLE_US 1000000u
+
+static StageHistogram histograms[STAGE_COUNT];
+static bool hardOverrunThisCycle = false;
+static bool timingArmed = false;
+
+static const uint32_t STAGE_DEADLINE_US[STAGE_COUNT] = {
+  STAGE_DEADLINE_ACQUIRE_US,
+  STAGE_DEADLINE_CLASSIFY_US,
+  STAGE_DEADLINE_ENCODE_US,
+  STAGE_DEADLINE_TRANSMIT_US,
+};
+
+static inline uint32_t cycleCount() {
+  uint32_t ccount;
+  __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+  return ccount;
+}
+
+void stageTimingBegin() {
+  if (timingArmed) return;
+  timingArmed = true;
+
+  // Subscribe this task; from now on only stageTimingCycleComplete()
+  // pets it, so a wedged stage ends in a watchdog reboot
+  esp_task_wdt_add(NULL);
+
+  Serial.println("✅ Stage timing armed (histograms + deadline budget)");
+}
+
+uint32_t stageTimingStart() {
+  return cycleCount();
+}
+
+uint32_t stageTimingEnd(PipelineStage stage, uint32_t startTicks) {
+  uint32_t elapsedTicks = cycleCount() - startTicks;   // wrap-safe
+  uint32_t us = elapsedTicks / (uint32_t)(getCpuFrequencyMhz());
+
+  if (stage >= STAGE_COUNT || us >= STAGE_MAX_CREDIBLE_US) {
+    return us;
+  }
+
+  StageHistogram &h = histograms[stage];
+
+  // log2 bucket index without a loop: position of the highest set bit
+  uint32_t bucket = us == 0 ? 0 : (31 - __builtin_clz(us | 1));
+  if (bucket >= STAGE_TIMING_BUCKETS) bucket = STAGE_TIMING_BUCKETS - 1;
+
+  h.buckets[bucket]++;
+  h.count++;
+  h.sumUs += us;
+  if (us > h.maxUs) h.maxUs = us;
+
+  if (us > STAGE_DEADLINE_US[stage]) {
+    h.deadlineMisses++;
+    GGLOG(GGLOG_STAGE_OVERRUN, (uint16_t)stage, (int32_t)us,
+          (int32_t)STAGE_DEADLINE_US[stage]);
+
+    if (us > STAGE_DEADLINE_US[stage] * STAGE_HARD_FACTOR) {
+      hardOverrunThisCycle = true;
+    }
+  }
+
+  return us;
+}
+
+void stageTimingCycleComplete() {
+  if (!timingArmed) return;
+
+  if (!hardOverrunThisCycle) {
+    esp_task_wdt_reset();
+  }
+  hardOverrunThisCycle = false;
+}
+
+const StageHistogram *stageTimingHistogram(PipelineStage stage) {
+  if (stage >= STAGE_COUNT) return NULL;
+  return &histograms[stage];
+}
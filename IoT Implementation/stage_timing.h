@@ -0,0 +1,88 @@
+/**
+ * GasGuard - Pipeline Stage Timing and Deadline Budget
+ *
+ * Nothing in the firmware measured where time goes: a stall in any
+ * stage (a network retry, a flash write) silently degraded sampling
+ * cadence and surfaced only as unexplained reading gaps in MongoDB.
+ *
+ * This framework timestamps the pipeline's stage boundaries with the
+ * Xtensa cycle counter (sub-microsecond, two instructions per probe)
+ * and retains per-stage running histograms in RAM — log2 microsecond
+ * buckets plus count/sum/max — cheap enough to run on every reading on
+ * every production node. The histograms ride the uplink heartbeat, so
+ * the fleet dashboard can chart p99 stage latency across nodes and
+ * find the tail stalls.
+ *
+ * Each stage also carries a deadline budget. A stage overrunning its
+ * deadline is counted and logged (GGLOG, never printf on the hot
+ * path); the task watchdog is fed through this framework — the
+ * processing task pets the WDT only when the cycle completed without a
+ * hard overrun (STAGE_HARD_FACTOR x deadline), so a genuinely wedged
+ * stage stops the petting and the watchdog reboots the node instead of
+ * letting it limp.
+ */
+
+#ifndef GASGUARD_STAGE_TIMING_H
+#define GASGUARD_STAGE_TIMING_H
+
+#include <stdint.h>
+
+enum PipelineStage {
+  STAGE_ACQUIRE = 0,   // readAllSensors(): snapshot + conversion
+  STAGE_CLASSIFY,      // risk classification + relay decision
+  STAGE_ENCODE,        // anomaly gate + uplink frame building
+  STAGE_TRANSMIT,      // MQTT publish path
+  STAGE_COUNT
+};
+
+// Log2-microsecond histogram: bucket i covers [2^i, 2^(i+1)) us,
+// bucket 0 is <2 us, the last bucket is everything >= 32 ms
+#define STAGE_TIMING_BUCKETS 16
+
+// Per-stage soft deadlines (us). Overruns are counted and logged;
+// sustained hard overruns (factor below) stop the watchdog petting.
+#define STAGE_DEADLINE_ACQUIRE_US   5000
+#define STAGE_DEADLINE_CLASSIFY_US  500
+#define STAGE_DEADLINE_ENCODE_US    2000
+#define STAGE_DEADLINE_TRANSMIT_US  50000
+#define STAGE_HARD_FACTOR           8
+
+struct StageHistogram {
+  uint32_t buckets[STAGE_TIMING_BUCKETS];
+  uint32_t count;
+  uint64_t sumUs;
+  uint32_t maxUs;
+  uint32_t deadlineMisses;
+};
+
+/**
+ * Arm the framework and subscribe the calling task to the task
+ * watchdog. Call from the processing task before its loop.
+ */
+void stageTimingBegin();
+
+/**
+ * Raw cycle-counter timestamp opening a stage.
+ */
+uint32_t stageTimingStart();
+
+/**
+ * Close a stage: fold the elapsed time into its histogram and check
+ * the deadline. Returns the elapsed microseconds.
+ */
+uint32_t stageTimingEnd(PipelineStage stage, uint32_t startTicks);
+
+/**
+ * End-of-cycle watchdog feed: pets the task WDT unless a stage in this
+ * cycle overran its hard budget (deadline x STAGE_HARD_FACTOR) — a
+ * wedged stage then reboots the node via the watchdog.
+ */
+void stageTimingCycleComplete();
+
+/**
+ * Read access for the heartbeat exporter; single writer per stage, so
+ * a read from the same task is coherent.
+ */
+const StageHistogram *stageTimingHistogram(PipelineStage stage);
+
+#endif // GASGUARD_STAGE_TIMING_H
@@ -0,0 +1,91 @@
+/**
+ * GasGuard - Static Arena and Heap Trap (implementation)
+ *
+ * The trap overrides the global C++ allocation operators, which is
+ * enough to catch String churn and accidental std-container use in
+ * firmware code. It deliberately does not wrap libc malloc: the IDF
+ * network stacks allocate legitimately at runtime, and aborting inside
+ * a Wi-Fi interrupt would turn a diagnosis tool into an outage.
+ */
+
+#include <Arduino.h>
+
+#include "static_arena.h"
+
+static uint8_t arena[ARENA_SIZE] __attribute__((aligned(4)));
+static size_t arenaOffset = 0;
+static bool sealed = false;
+static uint32_t freeHeapAtSeal = 0;
+
+void *arenaAlloc(size_t size) {
+  if (sealed) {
+    Serial.printf("❌ Arena: alloc of %u B after seal refused\n",
+                  (unsigned)size);
+    return NULL;
+  }
+
+  size = (size + 3) & ~(size_t)3;   // 4-byte alignment
+  if (arenaOffset + size > ARENA_SIZE) {
+    Serial.printf("❌ Arena: exhausted (%u B requested, %u B left) — "
+                  "grow ARENA_SIZE\n",
+                  (unsigned)size, (unsigned)(ARENA_SIZE - arenaOffset));
+    return NULL;
+  }
+
+  void *ptr = &arena[arenaOffset];
+  arenaOffset += size;
+  return ptr;
+}
+
+size_t arenaUsed() {
+  return arenaOffset;
+}
+
+size_t arenaRemaining() {
+  return ARENA_SIZE - arenaOffset;
+}
+
+void arenaSealHeap() {
+  sealed = true;
+  freeHeapAtSeal = ESP.getFreeHeap();
+  Serial.printf("🔒 Heap sealed: arena %u/%u B used, %u B free heap\n",
+                (unsigned)arenaOffset, ARENA_SIZE, freeHeapAtSeal);
+}
+
+bool arenaHeapSealed() {
+  return sealed;
+}
+
+int32_t arenaHeapDrift() {
+  if (!sealed) return 0;
+  return (int32_t)freeHeapAtSeal - (int32_t)ESP.getFreeHeap();
+}
+
+// ============================================================================
+// INSTRUMENTED BUILD: TRAP POST-SEAL C++ ALLOCATION
+// ============================================================================
+
+#if GASGUARD_HEAP_TRAP
+
+static void *trapAlloc(size_t size) {
+  if (sealed) {
+    // Loud and fatal on purpose: the offending call site is in the
+    // backtrace, and finding it in the lab beats fragmenting in the
+    // field for a year
+    Serial.printf("💥 HEAP TRAP: operator new(%u) after setup() — "
+                  "steady state must not allocate\n",
+                  (unsigned)size);
+    Serial.flush();
+    abort();
+  }
+  return malloc(size);
+}
+
+void *operator new(size_t size) { return trapAlloc(size); }
+void *operator new[](size_t size) { return trapAlloc(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+
+#endif // GASGUARD_HEAP_TRAP
@@ -0,0 +1,116 @@
+/**
+ * GasGuard - Static Arena, Fixed Pools and Heap-Free Guarantee
+ *
+ * Heap fragmentation is the top field-failure cause on long-uptime
+ * nodes: a year of per-message String/malloc churn slowly shreds the
+ * ESP32 heap until some 2 KB Wi-Fi buffer can't be placed and the node
+ * wedges. The firmware's own buffers are already static (snapshot
+ * ring, uplink encoder, MQTT pending slots, flight-recorder arena, log
+ * ring); this module makes that a checkable rule instead of a habit:
+ *
+ *   - arenaAlloc(): a boot-time bump arena for anything that needs
+ *     sizing at setup() time. Never freed, so it cannot fragment.
+ *   - StaticPool<T, N>: fixed-slot pool for per-message objects that
+ *     transport/logging features would otherwise heap-allocate.
+ *   - arenaSealHeap(): called at the end of setup(). From then on the
+ *     steady state is expected to be allocation-free; with
+ *     GASGUARD_HEAP_TRAP the instrumented build aborts loudly on the
+ *     first post-seal operator new, pointing at the offending feature
+ *     before it ships. All builds track the free-heap watermark drift
+ *     since seal for the heartbeat.
+ *
+ * The trap covers C++ allocation (new, String, std containers) in our
+ * code. Allocations inside the IDF Wi-Fi/TCP stacks are outside our
+ * control and deliberately not trapped — watermark drift catches a
+ * leak there too, just less precisely.
+ */
+
+#ifndef GASGUARD_STATIC_ARENA_H
+#define GASGUARD_STATIC_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Instrumented build: abort on any post-seal operator new. Leave 0 in
+// release images — the watermark drift check still runs.
+#define GASGUARD_HEAP_TRAP 0
+
+// Boot-time arena size. Everything sized at setup() time comes from
+// here; steady state allocates nothing.
+#define ARENA_SIZE (8 * 1024)
+
+/**
+ * Bump-allocate from the boot arena, 4-byte aligned. Only valid before
+ * arenaSealHeap(); returns NULL when sealed or exhausted (and logs the
+ * refusal — running out at boot is a build-time sizing bug, not a
+ * runtime condition to handle gracefully).
+ */
+void *arenaAlloc(size_t size);
+
+/**
+ * Arena bytes consumed / still available (diagnostics).
+ */
+size_t arenaUsed();
+size_t arenaRemaining();
+
+/**
+ * Declare setup() complete: the arena closes and the steady state is
+ * expected to be allocation-free. Records the free-heap watermark for
+ * drift tracking; with GASGUARD_HEAP_TRAP, post-seal operator new
+ * aborts with the allocation size.
+ */
+void arenaSealHeap();
+
+bool arenaHeapSealed();
+
+/**
+ * Free-heap change since seal (positive = shrunk). A steadily growing
+ * value is the fragmentation death spiral starting; exported in the
+ * heartbeat so the fleet dashboard can trend it.
+ */
+int32_t arenaHeapDrift();
+
+/**
+ * Fixed-slot object pool. acquire() returns NULL when exhausted — the
+ * caller degrades (drops the message, reuses a slot) instead of
+ * touching the heap. Single free-list guarded by the caller's
+ * concurrency discipline: pools used from more than one task must be
+ * wrapped in a critical section, same as the log ring's producers.
+ */
+template <typename T, size_t N>
+class StaticPool {
+ public:
+  StaticPool() {
+    for (size_t i = 0; i < N; i++) {
+      next[i] = (int16_t)(i + 1 < N ? i + 1 : -1);
+    }
+    freeHead = 0;
+  }
+
+  T *acquire() {
+    if (freeHead < 0) return NULL;
+    int16_t slot = freeHead;
+    freeHead = next[slot];
+    inUseCount++;
+    return &slots[slot];
+  }
+
+  void release(T *obj) {
+    if (obj < slots || obj >= slots + N) return;
+    int16_t slot = (int16_t)(obj - slots);
+    next[slot] = freeHead;
+    freeHead = slot;
+    inUseCount--;
+  }
+
+  size_t inUse() const { return inUseCount; }
+  size_t capacity() const { return N; }
+
+ private:
+  T slots[N];
+  int16_t next[N];
+  int16_t freeHead;
+  size_t inUseCount = 0;
+};
+
+#endif // GASGUARD_STATIC_ARENA_H
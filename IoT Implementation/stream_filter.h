@@ -0,0 +1,95 @@
+/**
+ * GasGuard - Streaming Per-Channel Sample Filter
+ *
+ * Incremental replacement for the batch mean in the old readVoltage():
+ * an EWMA running mean plus an EWMA variance estimate, updated O(1) per
+ * sample straight from the DMA stream. The "current reading" is always
+ * available instantly — no 500 ms accumulation window.
+ *
+ * Spike rejection: a sample deviating more than STREAM_FILTER_K sigmas
+ * from the running mean is treated as an ADC glitch. It is not averaged
+ * in at full weight (a single glitch can no longer skew the estimate)
+ * but still bleeds in slowly, so a genuine step change — a real leak
+ * onset — converges within a few samples instead of being ignored.
+ *
+ * Pure C++, no Arduino dependencies: the same code runs on host for
+ * testing and replay.
+ */
+
+#ifndef GASGUARD_STREAM_FILTER_H
+#define GASGUARD_STREAM_FILTER_H
+
+#include <stdint.h>
+
+// Default EWMA weight for the mean (1/16: ~16-sample time constant,
+// comparable smoothing to the old 10-sample batch mean at a fraction of
+// the lag). Runtime-tunable per filter via the alpha member — the
+// adaptive sampling controller trades smoothing for responsiveness when
+// risk rises.
+#define STREAM_FILTER_ALPHA       (1.0f / 16.0f)
+
+// EWMA weight for the variance (slower, keeps the gate stable)
+#define STREAM_FILTER_BETA        (1.0f / 32.0f)
+
+// Rejection threshold in sigmas
+#define STREAM_FILTER_K           4.0f
+
+// Variance floor in counts^2 — keeps the gate sane on very quiet
+// channels where the EWMA variance would otherwise collapse to ~0
+#define STREAM_FILTER_VAR_FLOOR   4.0f
+
+struct StreamFilter {
+  float mean = 0.0f;
+  float variance = STREAM_FILTER_VAR_FLOOR;
+  float alpha = STREAM_FILTER_ALPHA;   // mean weight, runtime-tunable
+  bool primed = false;
+  uint32_t accepted = 0;
+  uint32_t rejected = 0;
+
+  /**
+   * Fold one raw sample in. O(1), no sqrt — the gate compares squared
+   * deviation against K^2 * variance.
+   */
+  void update(float sample) {
+    if (!primed) {
+      mean = sample;
+      primed = true;
+      accepted++;
+      return;
+    }
+
+    float dev = sample - mean;
+    float gate = STREAM_FILTER_K * STREAM_FILTER_K * variance;
+
+    if (dev * dev > gate) {
+      // Outlier: reject at full weight, bleed in slowly (spikes are
+      // one-off; a sustained level shift — a real leak — still pulls
+      // the mean over)
+      mean += (alpha / 8.0f) * dev;
+      rejected++;
+      return;
+    }
+
+    mean += alpha * dev;
+    variance += STREAM_FILTER_BETA * (dev * dev - variance);
+    if (variance < STREAM_FILTER_VAR_FLOOR) {
+      variance = STREAM_FILTER_VAR_FLOOR;
+    }
+    accepted++;
+  }
+
+  /**
+   * Current estimate; valid once at least one sample has arrived
+   */
+  float value() const { return mean; }
+
+  void reset() {
+    mean = 0.0f;
+    variance = STREAM_FILTER_VAR_FLOOR;
+    primed = false;
+    accepted = 0;
+    rejected = 0;
+  }
+};
+
+#endif // GASGUARD_STREAM_FILTER_H
@@ -0,0 +1,187 @@
+/**
+ * GasGuard - Batched Delta-Encoded Binary Uplink Format
+ *
+ * Replaces one ~300-byte JSON POST per reading with one compact binary
+ * frame per batch of snapshots. Wire format ("GG1"):
+ *
+ *   [0] 'G'  [1] 'G'  [2] version (1)  [3] snapshot count N
+ *   first snapshot: 4 channels as zigzag-varint absolute centi-PPM
+ *   snapshots 2..N: 4 channels as zigzag-varint deltas vs previous
+ *
+ * PPM values are carried as int32 centi-PPM (0.01 PPM resolution, range
+ * ±21M PPM — far beyond any sensor). Flat NORMAL traffic delta-encodes
+ * to 1 byte per channel, so a 16-snapshot frame is typically ~70 bytes
+ * against ~4.8 KB of the JSON equivalent.
+ *
+ * Encoder and decoder are pure C++ with static buffers only (no heap),
+ * shared by the firmware, the gateway, and host-side tools.
+ */
+
+#ifndef GASGUARD_UPLINK_CODEC_H
+#define GASGUARD_UPLINK_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "gas_readings.h"
+
+#define UPLINK_MAGIC_0     'G'
+#define UPLINK_MAGIC_1     'G'
+#define UPLINK_VERSION     1
+#define UPLINK_HEADER_SIZE 4
+
+// Snapshots per frame. 16 cuts request rate 16x and amortizes the
+// TCP/TLS round trip; worst case (4 channels x 5-byte varints) stays
+// under 350 bytes of payload.
+#define UPLINK_BATCH_SIZE  16
+
+#define UPLINK_CHANNELS    4
+#define UPLINK_MAX_FRAME   (UPLINK_HEADER_SIZE + \
+                            UPLINK_BATCH_SIZE * UPLINK_CHANNELS * 5)
+
+// ============================================================================
+// VARINT PRIMITIVES
+// ============================================================================
+
+/**
+ * Zigzag: map signed deltas to unsigned so small magnitudes of either
+ * sign encode in one varint byte
+ */
+inline uint32_t uplinkZigzag(int32_t v) {
+  return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+inline int32_t uplinkUnzigzag(uint32_t v) {
+  return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+/**
+ * LEB128 varint append; returns bytes written (1-5)
+ */
+inline size_t uplinkPutVarint(uint8_t *out, uint32_t v) {
+  size_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = (uint8_t)v;
+  return n;
+}
+
+/**
+ * Varint read; returns bytes consumed, 0 on malformed/truncated input
+ */
+inline size_t uplinkGetVarint(const uint8_t *in, size_t avail, uint32_t *v) {
+  uint32_t result = 0;
+  size_t n = 0;
+  while (n < avail && n < 5) {
+    uint8_t b = in[n];
+    result |= (uint32_t)(b & 0x7F) << (7 * n);
+    n++;
+    if ((b & 0x80) == 0) {
+      *v = result;
+      return n;
+    }
+  }
+  return 0;
+}
+
+// ============================================================================
+// ENCODER
+// ============================================================================
+
+struct UplinkEncoder {
+  uint8_t frame[UPLINK_MAX_FRAME];
+  size_t length = 0;
+  uint8_t count = 0;
+  int32_t prev[UPLINK_CHANNELS] = {0};
+
+  /**
+   * Start a new frame (also discards any unfinished one)
+   */
+  void reset() {
+    frame[0] = UPLINK_MAGIC_0;
+    frame[1] = UPLINK_MAGIC_1;
+    frame[2] = UPLINK_VERSION;
+    frame[3] = 0;
+    length = UPLINK_HEADER_SIZE;
+    count = 0;
+  }
+
+  /**
+   * Append one snapshot. Returns true when the frame is full and ready
+   * to ship via data()/size().
+   */
+  bool addSnapshot(const GasReadings &r) {
+    if (count == 0 && length != UPLINK_HEADER_SIZE) reset();
+
+    int32_t centi[UPLINK_CHANNELS] = {
+      (int32_t)(r.methane * 100.0f + 0.5f),
+      (int32_t)(r.lpg * 100.0f + 0.5f),
+      (int32_t)(r.carbonMonoxide * 100.0f + 0.5f),
+      (int32_t)(r.hydrogenSulfide * 100.0f + 0.5f),
+    };
+
+    for (int ch = 0; ch < UPLINK_CHANNELS; ch++) {
+      // First snapshot is absolute; the rest are deltas vs previous
+      int32_t value = (count == 0) ? centi[ch] : centi[ch] - prev[ch];
+      length += uplinkPutVarint(frame + length, uplinkZigzag(value));
+      prev[ch] = centi[ch];
+    }
+
+    count++;
+    frame[3] = count;
+    return count >= UPLINK_BATCH_SIZE;
+  }
+
+  const uint8_t *data() const { return frame; }
+  size_t size() const { return length; }
+  uint8_t snapshots() const { return count; }
+};
+
+// ============================================================================
+// DECODER (gateway / host side)
+// ============================================================================
+
+/**
+ * Decode a frame into `out[maxOut]`. Returns the number of snapshots
+ * decoded, or -1 on a malformed frame.
+ */
+inline int uplinkDecode(const uint8_t *frame, size_t frameLen,
+                        GasReadings *out, size_t maxOut) {
+  if (frameLen < UPLINK_HEADER_SIZE ||
+      frame[0] != UPLINK_MAGIC_0 || frame[1] != UPLINK_MAGIC_1 ||
+      frame[2] != UPLINK_VERSION) {
+    return -1;
+  }
+
+  uint8_t count = frame[3];
+  if (count > maxOut) count = (uint8_t)maxOut;
+
+  size_t pos = UPLINK_HEADER_SIZE;
+  int32_t prev[UPLINK_CHANNELS] = {0};
+
+  for (uint8_t i = 0; i < count; i++) {
+    int32_t centi[UPLINK_CHANNELS];
+    for (int ch = 0; ch < UPLINK_CHANNELS; ch++) {
+      uint32_t raw = 0;
+      size_t used = uplinkGetVarint(frame + pos, frameLen - pos, &raw);
+      if (used == 0) return -1;
+      pos += used;
+
+      int32_t value = uplinkUnzigzag(raw);
+      centi[ch] = (i == 0) ? value : prev[ch] + value;
+      prev[ch] = centi[ch];
+    }
+
+    out[i].methane = centi[0] / 100.0f;
+    out[i].lpg = centi[1] / 100.0f;
+    out[i].carbonMonoxide = centi[2] / 100.0f;
+    out[i].hydrogenSulfide = centi[3] / 100.0f;
+    out[i].valid = true;
+  }
+
+  return count;
+}
+
+#endif // GASGUARD_UPLINK_CODEC_H
@@ -0,0 +1,111 @@
+/**
+ * GasGuard - Ventilation Relay Controller (implementation)
+ *
+ * All pin writes happen on the processing task inside
+ * ventControlUpdate(); cross-task input is confined to the atomic
+ * mode word, so there is no lock and no window where two contexts
+ * race on the relay state.
+ */
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "vent_control.h"
+#include "mqtt_uplink.h"
+
+// Written by any context, read once per update (see header)
+static std::atomic<uint8_t> requestedMode{VENT_AUTO};
+
+// Processing-task-private control state
+static bool relayOn = false;
+static uint32_t lastSwitchMs = 0;
+static bool reportPending = false;
+static VentTransition lastTransition;
+
+static void switchRelay(bool on, VentMode mode, RiskState risk,
+                        uint32_t nowMs) {
+  relayOn = on;
+  lastSwitchMs = nowMs;
+  digitalWrite(VENT_RELAY_PIN, on ? HIGH : LOW);
+
+  lastTransition.ms = nowMs;
+  lastTransition.mode = (uint8_t)mode;
+  lastTransition.relayOn = on ? 1 : 0;
+  lastTransition.risk = (uint8_t)risk;
+  lastTransition.reserved = 0;
+  reportPending = true;
+
+  Serial.printf("🌀 Ventilation %s (mode %u, risk %u)\n",
+                on ? "ON" : "OFF", (unsigned)mode, (unsigned)risk);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void ventControlBegin() {
+  pinMode(VENT_RELAY_PIN, OUTPUT);
+  digitalWrite(VENT_RELAY_PIN, LOW);
+  relayOn = false;
+  lastSwitchMs = millis();
+}
+
+void ventControlUpdate(RiskState risk) {
+  VentMode mode = (VentMode)requestedMode.load(std::memory_order_relaxed);
+  uint32_t now = millis();
+
+  bool demand;
+  switch (mode) {
+    case VENT_FORCED: demand = true; break;
+    case VENT_OFF:    demand = (risk >= RISK_CRITICAL); break;
+    default:          demand = (risk >= RISK_WARNING); break;
+  }
+
+  if (demand != relayOn) {
+    if (demand) {
+      // CRITICAL does not wait out the minimum-off period
+      if (risk >= RISK_CRITICAL || now - lastSwitchMs >= VENT_MIN_OFF_MS) {
+        switchRelay(true, mode, risk, now);
+      }
+    } else {
+      if (now - lastSwitchMs >= VENT_MIN_ON_MS) {
+        switchRelay(false, mode, risk, now);
+      }
+    }
+  }
+
+  // Asynchronous transition report; retried until the link carries it
+  // or the next transition supersedes it
+  if (reportPending &&
+      mqttUplinkPublishEvent("vent", (const uint8_t *)&lastTransition,
+                             sizeof(lastTransition))) {
+    reportPending = false;
+  }
+}
+
+void ventControlSetMode(VentMode mode) {
+  if (mode > VENT_FORCED) return;
+  requestedMode.store((uint8_t)mode, std::memory_order_relaxed);
+}
+
+VentMode ventControlMode() {
+  return (VentMode)requestedMode.load(std::memory_order_relaxed);
+}
+
+bool ventControlRelayOn() {
+  return relayOn;
+}
+
+// ============================================================================
+// DOWNLINK
+// ============================================================================
+
+static void ventDownlinkHandler(const char *topicSuffix, const uint8_t *data,
+                                size_t len) {
+  if (len < 1) return;
+  ventControlSetMode((VentMode)data[0]);
+}
+
+void ventControlBindDownlink() {
+  mqttUplinkOnDownlink("vent", ventDownlinkHandler);
+}
@@ -0,0 +1,87 @@
+/**
+ * GasGuard - Ventilation Relay Controller
+ *
+ * Firmware-resident control loop for the 1-channel relay driving the
+ * 12V fan (see the wiring photo in this directory). Until now the
+ * relay was a bare digitalWrite() in the processing task and the real
+ * decision lived in the backend's VentilationStatus round trip —
+ * multi-second latency on the one actuator that matters. This
+ * controller runs against the on-device classifier, so the fan reacts
+ * within one sampling period.
+ *
+ * Modes mirror the backend enum (OFF / AUTO / FORCED):
+ *
+ *   AUTO    relay follows the classifier — on at WARNING and above
+ *   FORCED  relay on regardless of readings (operator override)
+ *   OFF     relay off, maintenance lockout — except that CRITICAL
+ *           still forces the fan on; a gas alarm outranks a lockout
+ *
+ * Minimum-on/minimum-off debounce protects the relay contacts and the
+ * fan motor from chatter when readings hover around a threshold; the
+ * emergency path (CRITICAL) bypasses the minimum-off wait.
+ *
+ * Mode commands arrive on gasguard/<clientId>/vent (one byte, the
+ * VentMode value) from the esp-mqtt task; the setter is a single
+ * atomic store, so commands are safe from any task or ISR context.
+ * Every relay transition is reported upstream asynchronously as a
+ * "vent" event — publish failure while offline is not retried beyond
+ * the next transition, since the risk stream carries the same story.
+ */
+
+#ifndef GASGUARD_VENT_CONTROL_H
+#define GASGUARD_VENT_CONTROL_H
+
+#include <stdint.h>
+
+#include "risk_classifier.h"
+
+// Relay IN pin (active HIGH through the driver transistor)
+#define VENT_RELAY_PIN    25
+
+// Contact/motor protection: no faster cycling than this
+#define VENT_MIN_ON_MS    30000
+#define VENT_MIN_OFF_MS   15000
+
+// Mirrors backend-new/models/VentilationStatus.js mode enum
+enum VentMode : uint8_t {
+  VENT_OFF    = 0,
+  VENT_AUTO   = 1,
+  VENT_FORCED = 2,
+};
+
+// Transition report published on the "vent" event topic (8 bytes)
+struct VentTransition {
+  uint32_t ms;        // millis() at the switch
+  uint8_t mode;       // VentMode in effect
+  uint8_t relayOn;    // new relay state
+  uint8_t risk;       // RiskState that drove it
+  uint8_t reserved;
+};
+
+/**
+ * Claim the relay pin (starts off, mode AUTO). Call once from
+ * firmwareTasksBegin() before the processing task runs.
+ */
+void ventControlBegin();
+
+/**
+ * One control-loop step; call from the processing task with each
+ * classified snapshot. Applies mode, demand and debounce, drives the
+ * pin, and reports any transition upstream.
+ */
+void ventControlUpdate(RiskState risk);
+
+/**
+ * Change mode. Lock-free single store — callable from the MQTT task,
+ * an ISR, or anywhere else; the processing task picks it up on its
+ * next update.
+ */
+void ventControlSetMode(VentMode mode);
+
+VentMode ventControlMode();
+bool ventControlRelayOn();
+
+/** Subscribe mode commands on gasguard/<clientId>/vent. */
+void ventControlBindDownlink();
+
+#endif // GASGUARD_VENT_CONTROL_H
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+GasGuard - bandwidth-shaped fleet rollout scheduler
+
+Pushes an OTA delta patch (make_delta.py) to a fleet of nodes over the
+zone MQTT broker, shaped so a campaign shares the Wi-Fi with live
+sensor traffic instead of flattening it: nodes update in waves of
+--concurrent, and patch bytes are paced to --rate-kbps aggregate across
+the wave. With the default 64 KB patch, 32 kbps and 8-node waves, a
+400-node campaign completes in a few hours instead of a technician-
+weekend of USB reflashing.
+
+Delivery uses mosquitto_pub (same broker the uplink uses); each node
+listens on gasguard/<clientID>/ota and applies the patch streamingly,
+so chunk size only affects pacing granularity.
+
+Usage:
+    python3 fleet_rollout.py --patch patch.ggd --nodes nodes.txt \
+        [--broker localhost] [--rate-kbps 32] [--concurrent 8] \
+        [--chunk 1024]
+
+nodes.txt: one clientID per line (ZONE_A_01 ...), '#' comments allowed.
+"""
+
+import argparse
+import subprocess
+import sys
+import time
+
+
+def parse_args():
+    p = argparse.ArgumentParser()
+    p.add_argument("--patch", required=True)
+    p.add_argument("--nodes", required=True)
+    p.add_argument("--broker", default="localhost")
+    p.add_argument("--rate-kbps", type=float, default=32.0)
+    p.add_argument("--concurrent", type=int, default=8)
+    p.add_argument("--chunk", type=int, default=1024)
+    return p.parse_args()
+
+
+def load_nodes(path):
+    nodes = []
+    for line in open(path):
+        line = line.strip()
+        if line and not line.startswith("#"):
+            nodes.append(line)
+    return nodes
+
+
+def publish_chunk(broker, node, chunk):
+    result = subprocess.run(
+        ["mosquitto_pub", "-h", broker, "-q", "1",
+         "-t", "gasguard/%s/ota" % node, "-s"],
+        input=chunk)
+    return result.returncode == 0
+
+
+def main():
+    args = parse_args()
+    patch = open(args.patch, "rb").read()
+    nodes = load_nodes(args.nodes)
+    if not nodes:
+        sys.stderr.write("no nodes in %s\n" % args.nodes)
+        return 1
+
+    chunks = [patch[i:i + args.chunk] for i in range(0, len(patch), args.chunk)]
+    bytes_per_sec = args.rate_kbps * 1024 / 8
+
+    print("Rolling %d B patch (%d chunks) to %d nodes, waves of %d @ %g kbps"
+          % (len(patch), len(chunks), len(nodes), args.concurrent,
+             args.rate_kbps))
+
+    started = time.time()
+    failed = []
+    for wave_start in range(0, len(nodes), args.concurrent):
+        wave = nodes[wave_start:wave_start + args.concurrent]
+        print("wave %d: %s" % (wave_start // args.concurrent + 1,
+                               ", ".join(wave)))
+
+        # Round-robin chunks across the wave; sleeping per chunk keeps
+        # the aggregate at the configured rate
+        alive = set(wave)
+        for chunk in chunks:
+            for node in list(alive):
+                if not publish_chunk(args.broker, node, chunk):
+                    print("  %s: publish failed, dropping from wave" % node)
+                    alive.discard(node)
+                    failed.append(node)
+                time.sleep(len(chunk) / bytes_per_sec)
+
+    elapsed = time.time() - started
+    print("done in %.0f s; %d node(s) failed%s" %
+          (elapsed, len(failed), ": " + ", ".join(failed) if failed else ""))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
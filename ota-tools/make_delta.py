@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""
+GasGuard - OTA delta patch builder
+
+Builds the binary delta patch the firmware applier (IoT Implementation/
+ota_delta.cpp) consumes: a 32-byte header followed by only the 4 KB
+pages that differ between the base and target images, in ascending page
+order. A typical tuning change yields a patch of tens of KB against a
+~1.3 MB image.
+
+Usage:
+    python3 make_delta.py base.bin target.bin patch.ggd
+
+Format ("GGD1", little-endian):
+    header: magic u32, version u16, reserved u16, baseCrc32 u32,
+            targetCrc32 u32, baseSize u32, targetSize u32, deltaSize u32
+    record: pageIndex u32, dataLen u32, data[dataLen]
+"""
+
+import struct
+import sys
+import zlib
+
+PAGE_SIZE = 4096
+MAGIC = 0x47474431
+VERSION = 1
+HEADER = struct.Struct("<IHHIIIII")
+
+
+def pages(data):
+    for i in range(0, len(data), PAGE_SIZE):
+        yield i // PAGE_SIZE, data[i:i + PAGE_SIZE]
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.stderr.write(__doc__)
+        return 1
+
+    base = open(sys.argv[1], "rb").read()
+    target = open(sys.argv[2], "rb").read()
+
+    records = b""
+    changed = 0
+    for index, page in pages(target):
+        base_page = base[index * PAGE_SIZE:(index + 1) * PAGE_SIZE]
+        if page != base_page:
+            records += struct.pack("<II", index, len(page)) + page
+            changed += 1
+
+    delta_size = HEADER.size + len(records)
+    header = HEADER.pack(MAGIC, VERSION, 0,
+                         zlib.crc32(base) & 0xFFFFFFFF,
+                         zlib.crc32(target) & 0xFFFFFFFF,
+                         len(base), len(target), delta_size)
+
+    with open(sys.argv[3], "wb") as f:
+        f.write(header + records)
+
+    total_pages = (len(target) + PAGE_SIZE - 1) // PAGE_SIZE
+    print("%s: %d/%d pages changed, patch %d B (full image %d B, %.1f%%)" %
+          (sys.argv[3], changed, total_pages, delta_size, len(target),
+           100.0 * delta_size / len(target)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
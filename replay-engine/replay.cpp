@@ -0,0 +1,386 @@
+/**
+ * GasGuard - Native Trace Replay Engine
+ *
+ * Load generator for the backend ingest path. The Python simulators
+ * (iot-simulator.py, simulator-service) top out at a few hundred
+ * readings/sec; this tool answers whether POST /api/readings survives
+ * tens of thousands.
+ *
+ * A counts CSV (see trace_to_csv.py) is memory-mapped and parsed once
+ * into raw ADC counts, converted through the exact firmware pipeline —
+ * the same ppm_lut.h / stream_filter.h / risk_classifier.h headers the
+ * node compiles — and replayed against /api/readings over N concurrent
+ * keep-alive HTTP/1.1 connections. Each connection impersonates one
+ * node (ZONE_A_01 style clientIDs) and paces itself at the trace's
+ * 1 Hz cadence scaled by the speed multiplier; --speed 0 removes
+ * pacing entirely for a saturation test.
+ *
+ * Usage:
+ *   ./replay --trace trace.csv [--host 127.0.0.1] [--port 3001]
+ *            [--connections 8] [--speed 100] [--loops 1]
+ */
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../IoT Implementation/ppm_lut.h"
+#include "../IoT Implementation/stream_filter.h"
+#include "../IoT Implementation/gas_readings.h"
+#include "../IoT Implementation/risk_classifier.h"
+#include "../IoT Implementation/batch_convert.h"
+
+// Firmware constants (sensor_ppm_converter.cpp)
+#define REPLAY_V_REF   3.3f
+#define REPLAY_ADC_MAX 4095.0f
+#define REPLAY_RL      10.0f
+#define REPLAY_R0      10.0f
+
+// Per-sensor curve constants, SCHED_CH_* order
+static constexpr double CURVE_A[4] = { 1012.0, 1009.0, 99.042, 44.947 };
+static constexpr double CURVE_B[4] = { -2.786, -2.35, -1.518, -3.445 };
+
+// Trace base cadence: one reading per node per second at --speed 1
+#define REPLAY_BASE_PERIOD_US 1000000
+
+struct Options {
+  std::string trace;
+  std::string host = "127.0.0.1";
+  int port = 3001;
+  int connections = 8;
+  double speed = 100.0;
+  int loops = 1;
+};
+
+struct Stats {
+  std::atomic<uint64_t> sent{0};
+  std::atomic<uint64_t> ok{0};
+  std::atomic<uint64_t> errors{0};
+  std::atomic<uint64_t> reconnects{0};
+};
+
+// ============================================================================
+// TRACE LOADING (mmap + single parse pass)
+// ============================================================================
+
+static std::vector<uint16_t> loadTrace(const std::string &path) {
+  std::vector<uint16_t> counts;
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    perror("open trace");
+    return counts;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return counts;
+  }
+
+  const char *data = (const char *)mmap(nullptr, st.st_size, PROT_READ,
+                                        MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    perror("mmap trace");
+    return counts;
+  }
+
+  counts.reserve(st.st_size / 4);
+  uint32_t value = 0;
+  bool inNumber = false;
+  for (off_t i = 0; i < st.st_size; i++) {
+    char c = data[i];
+    if (c >= '0' && c <= '9') {
+      value = value * 10 + (c - '0');
+      inNumber = true;
+    } else if (inNumber) {
+      if (value > 0 && value < 4095) counts.push_back((uint16_t)value);
+      value = 0;
+      inNumber = false;
+    }
+  }
+  if (inNumber && value > 0 && value < 4095) counts.push_back((uint16_t)value);
+
+  munmap((void *)data, st.st_size);
+  return counts;
+}
+
+// ============================================================================
+// FIRMWARE-PIPELINE CONVERSION
+// ============================================================================
+
+/**
+ * Pre-convert the whole trace through the firmware pipeline once:
+ * a stream-filter pass per channel produces SoA filtered-counts
+ * columns, then the shared SoA kernel (batch_convert.h — the same
+ * code the ESP-NOW gateway runs per tick) converts everything in four
+ * calls. Workers then only format and send, so the HTTP path is the
+ * only thing under test.
+ */
+static std::vector<GasReadings> convertTrace(
+    const std::vector<uint16_t> &trace, const PpmLut luts[4]) {
+  size_t n = trace.size();
+  std::vector<uint16_t> counts[4];
+  StreamFilter filters[4];
+
+  for (int ch = 0; ch < 4; ch++) {
+    counts[ch].resize(n);
+    for (size_t i = 0; i < n; i++) {
+      // Slight per-channel skew so the four gases aren't identical
+      float c = trace[i] * (1.0f + 0.03f * ch);
+      if (c > 4094.0f) c = 4094.0f;
+      filters[ch].update(c);
+      counts[ch][i] = (uint16_t)filters[ch].value();
+    }
+  }
+
+  std::vector<float> ppm[4];
+  BatchCountsFrame soa;
+  float r0[4];
+  float *ppmOut[4];
+  for (int ch = 0; ch < 4; ch++) {
+    ppm[ch].resize(n);
+    soa.counts[ch] = counts[ch].data();
+    ppmOut[ch] = ppm[ch].data();
+    r0[ch] = REPLAY_R0;
+  }
+  soa.n = n;
+  batchConvertFrame(soa, luts, r0, ppmOut);
+
+  std::vector<GasReadings> readings(n);
+  for (size_t i = 0; i < n; i++) {
+    readings[i].methane = ppm[0][i];
+    readings[i].lpg = ppm[1][i];
+    readings[i].carbonMonoxide = ppm[2][i];
+    readings[i].hydrogenSulfide = ppm[3][i];
+    readings[i].valid = true;
+  }
+  return readings;
+}
+
+// ============================================================================
+// HTTP/1.1 KEEP-ALIVE CLIENT
+// ============================================================================
+
+static int connectTo(const std::string &host, int port) {
+  struct addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+
+  char portStr[16];
+  snprintf(portStr, sizeof(portStr), "%d", port);
+
+  struct addrinfo *res = nullptr;
+  if (getaddrinfo(host.c_str(), portStr, &hints, &res) != 0 || !res) {
+    return -1;
+  }
+
+  int fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+  if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(res);
+
+  if (fd >= 0) {
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, 1 /*TCP_NODELAY*/, &one, sizeof(one));
+  }
+  return fd;
+}
+
+/**
+ * Send one POST and drain the response. Returns the status code, or -1
+ * on a connection error (caller reconnects).
+ */
+static int postReading(int fd, const Options &opt, const char *clientId,
+                       const GasReadings &r) {
+  char body[512];
+  int bodyLen = snprintf(
+      body, sizeof(body),
+      "{\"clientID\":\"%s\",\"source\":\"replay-engine\","
+      "\"gases\":{\"methane\":%.2f,\"lpg\":%.2f,"
+      "\"carbonMonoxide\":%.2f,\"hydrogenSulfide\":%.2f},"
+      "\"environmental\":{\"temperature\":25,\"humidity\":65}}",
+      clientId, r.methane, r.lpg, r.carbonMonoxide, r.hydrogenSulfide);
+
+  char request[1024];
+  int reqLen = snprintf(request, sizeof(request),
+                        "POST /api/readings HTTP/1.1\r\n"
+                        "Host: %s:%d\r\n"
+                        "Content-Type: application/json\r\n"
+                        "Content-Length: %d\r\n"
+                        "Connection: keep-alive\r\n\r\n%s",
+                        opt.host.c_str(), opt.port, bodyLen, body);
+
+  if (write(fd, request, reqLen) != reqLen) return -1;
+
+  // Read headers, find Content-Length, drain the body; responses are
+  // small JSON so a single buffer pass is enough
+  char response[4096];
+  int total = 0;
+  int headerEnd = -1;
+  while (headerEnd < 0 && total < (int)sizeof(response) - 1) {
+    ssize_t n = read(fd, response + total, sizeof(response) - 1 - total);
+    if (n <= 0) return -1;
+    total += n;
+    response[total] = '\0';
+    char *sep = strstr(response, "\r\n\r\n");
+    if (sep) headerEnd = (sep - response) + 4;
+  }
+
+  int status = 0;
+  sscanf(response, "HTTP/1.1 %d", &status);
+
+  int contentLength = 0;
+  const char *cl = strcasestr(response, "Content-Length:");
+  if (cl) contentLength = atoi(cl + 15);
+
+  int bodyGot = total - headerEnd;
+  while (bodyGot < contentLength) {
+    ssize_t n = read(fd, response, sizeof(response));
+    if (n <= 0) return -1;
+    bodyGot += n;
+  }
+
+  return status;
+}
+
+// ============================================================================
+// WORKER: one node identity per connection
+// ============================================================================
+
+static void worker(int index, const Options &opt,
+                   const std::vector<GasReadings> &readings, Stats &stats) {
+  char clientId[32];
+  snprintf(clientId, sizeof(clientId), "ZONE_%c_%02d", 'A' + (index / 4) % 4,
+           (index % 4) + 1);
+
+  int64_t periodUs = 0;
+  if (opt.speed > 0) {
+    periodUs = (int64_t)(REPLAY_BASE_PERIOD_US / opt.speed);
+  }
+
+  int fd = connectTo(opt.host, opt.port);
+  auto next = std::chrono::steady_clock::now();
+
+  for (int loop = 0; loop < opt.loops; loop++) {
+    for (size_t i = 0; i < readings.size(); i++) {
+      const GasReadings &r = readings[i];
+
+      if (fd < 0) {
+        fd = connectTo(opt.host, opt.port);
+        if (fd < 0) {
+          stats.errors++;
+          std::this_thread::sleep_for(std::chrono::milliseconds(100));
+          continue;
+        }
+        stats.reconnects++;
+      }
+
+      int status = postReading(fd, opt, clientId, r);
+      stats.sent++;
+      if (status >= 200 && status < 300) {
+        stats.ok++;
+      } else {
+        stats.errors++;
+        if (status < 0) {
+          close(fd);
+          fd = -1;
+        }
+      }
+
+      if (periodUs > 0) {
+        next += std::chrono::microseconds(periodUs);
+        std::this_thread::sleep_until(next);
+      }
+    }
+  }
+
+  if (fd >= 0) close(fd);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(int argc, char **argv) {
+  Options opt;
+
+  for (int i = 1; i < argc - 1; i++) {
+    if (!strcmp(argv[i], "--trace")) opt.trace = argv[++i];
+    else if (!strcmp(argv[i], "--host")) opt.host = argv[++i];
+    else if (!strcmp(argv[i], "--port")) opt.port = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--connections")) opt.connections = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--speed")) opt.speed = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--loops")) opt.loops = atoi(argv[++i]);
+  }
+
+  if (opt.trace.empty()) {
+    fprintf(stderr,
+            "usage: replay --trace counts.csv [--host H] [--port P]\n"
+            "              [--connections N] [--speed X] [--loops L]\n"
+            "Generate counts.csv with: python3 trace_to_csv.py "
+            "../Datasets/dataset01/lpg_sensor.xlsx > counts.csv\n");
+    return 1;
+  }
+
+  std::vector<uint16_t> trace = loadTrace(opt.trace);
+  if (trace.empty()) {
+    fprintf(stderr, "no samples loaded from %s\n", opt.trace.c_str());
+    return 1;
+  }
+
+  // Per-channel firmware LUTs, built once and shared read-only
+  static PpmLut luts[4];
+  for (int ch = 0; ch < 4; ch++) {
+    luts[ch] = ppmLutBuild(CURVE_A[ch], CURVE_B[ch]);
+  }
+
+  // One firmware-pipeline conversion of the whole trace up front
+  std::vector<GasReadings> readings = convertTrace(trace, luts);
+
+  printf("Replaying %zu samples x %d loops on %d connections to "
+         "%s:%d (speed x%.0f)\n",
+         trace.size(), opt.loops, opt.connections, opt.host.c_str(),
+         opt.port, opt.speed);
+
+  Stats stats;
+  auto t0 = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < opt.connections; i++) {
+    threads.emplace_back(worker, i, std::cref(opt), std::cref(readings),
+                         std::ref(stats));
+  }
+  for (auto &t : threads) t.join();
+
+  double elapsed = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - t0)
+                       .count();
+
+  printf("\nsent      %lu\n", (unsigned long)stats.sent.load());
+  printf("2xx       %lu\n", (unsigned long)stats.ok.load());
+  printf("errors    %lu\n", (unsigned long)stats.errors.load());
+  printf("reconnect %lu\n", (unsigned long)stats.reconnects.load());
+  printf("elapsed   %.2f s\n", elapsed);
+  if (elapsed > 0) {
+    printf("rate      %.0f readings/sec\n", stats.sent.load() / elapsed);
+  }
+  return stats.errors.load() > stats.ok.load() ? 1 : 0;
+}
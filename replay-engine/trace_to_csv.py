@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""
+GasGuard - dataset to counts CSV for the replay engine
+
+Converts a Datasets/ xlsx trace (reading value in column D) into the
+flat ADC-counts CSV that replay.cpp memory-maps. Same PPM-to-counts
+inversion as IoT Implementation/bench/extract_trace.py, kept standard-
+library-only so it runs anywhere the repo checks out.
+
+Usage:
+    python3 trace_to_csv.py ../Datasets/dataset01/lpg_sensor.xlsx > counts.csv
+"""
+
+import re
+import sys
+import zipfile
+
+# MQ-6 constants from sensor_ppm_converter.cpp
+A = 1009.0
+B = -2.35
+R0 = 10.0
+RL = 10.0
+V_REF = 3.3
+ADC_MAX = 4095.0
+
+
+def read_column_d(path):
+    with zipfile.ZipFile(path) as z:
+        xml = z.read("xl/worksheets/sheet1.xml").decode()
+    values = []
+    for ref, attrs, val in re.findall(
+            r'<c r="D(\d+)"([^>]*)><v>([^<]+)</v></c>', xml):
+        if 't="s"' in attrs:
+            continue
+        values.append(float(val))
+    return values
+
+
+def ppm_to_counts(ppm):
+    if ppm <= 0:
+        ppm = 0.01
+    ratio = (ppm / A) ** (1.0 / B)
+    rs = ratio * R0
+    voltage = (V_REF * RL) / (rs + RL)
+    return max(1, min(4094, int(round(voltage * ADC_MAX / V_REF))))
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write(__doc__)
+        return 1
+    for value in read_column_d(sys.argv[1]):
+        print(ppm_to_counts(value))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())